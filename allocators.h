@@ -0,0 +1,251 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "segment_layout.h"
+#include "simple_vector_stats.h"
+
+//   malloc/free.  reallocate,  SimpleVector  
+//    realloc:    ,      ,
+//    glibc   mremap   
+template <typename Type>
+class MallocAllocator {
+    static_assert(alignof(Type) <= alignof(std::max_align_t), "malloc does not guarantee such alignment");
+
+public:
+    using value_type = Type;
+
+    MallocAllocator() noexcept = default;
+
+    template <typename Other>
+    MallocAllocator(const MallocAllocator<Other>&) noexcept {
+    }
+
+    Type* allocate(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(Type))
+            throw std::bad_array_new_length();
+        void* ptr = std::malloc(n * sizeof(Type));
+        if (!ptr)
+            throw std::bad_alloc();
+        return static_cast<Type*>(ptr);
+    }
+
+    void deallocate(Type* ptr, size_t) noexcept {
+        std::free(ptr);
+    }
+
+    //    ptr  old_n  new_n ,   .
+    //    .     std::bad_alloc,    
+    Type* reallocate(Type* ptr, size_t, size_t new_n) {
+        if (new_n > static_cast<size_t>(-1) / sizeof(Type))
+            throw std::bad_array_new_length();
+        void* new_ptr = std::realloc(ptr, new_n * sizeof(Type));
+        if (!new_ptr)
+            throw std::bad_alloc();
+        return static_cast<Type*>(new_ptr);
+    }
+
+    template <typename Other>
+    bool operator==(const MallocAllocator<Other>&) const noexcept {
+        return true;
+    }
+
+    template <typename Other>
+    bool operator!=(const MallocAllocator<Other>&) const noexcept {
+        return false;
+    }
+};
+
+
+// ,       Alignment 
+// (     Type),   -   SIMD-
+template <typename Type, size_t Alignment>
+class AlignedAllocator {
+    static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+public:
+    using value_type = Type;
+
+    static constexpr size_t kAlignment = Alignment > alignof(Type) ? Alignment : alignof(Type);
+
+    //    ,  allocator_traits     
+    template <typename Other>
+    struct rebind {
+        using other = AlignedAllocator<Other, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename Other>
+    AlignedAllocator(const AlignedAllocator<Other, Alignment>&) noexcept {
+    }
+
+    Type* allocate(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(Type))
+            throw std::bad_array_new_length();
+        return static_cast<Type*>(::operator new(n * sizeof(Type), std::align_val_t{ kAlignment }));
+    }
+
+    void deallocate(Type* ptr, size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t{ kAlignment });
+    }
+
+    template <typename Other>
+    bool operator==(const AlignedAllocator<Other, Alignment>&) const noexcept {
+        return true;
+    }
+
+    template <typename Other>
+    bool operator!=(const AlignedAllocator<Other, Alignment>&) const noexcept {
+        return false;
+    }
+};
+
+//    SimpleVector: SimpleVector<float, Aligned<64>>    64 
+template <size_t Alignment>
+using Aligned = AlignedAllocator<std::byte, Alignment>;
+
+//      ,    :  
+//  kMinBlockSize  kMaxBlockSize .    ,  , 
+// ,     .      
+// kMaxCachedBlocks ,         operator delete.
+//      :      .      .
+//  SIMPLE_VECTOR_ENABLE_STATS       SimpleVectorStatsRegistry
+class ThreadBufferPool {
+public:
+    static constexpr size_t kMinBlockSize = 64;
+    static constexpr size_t kClassCount = 21;
+    static constexpr size_t kMaxBlockSize = kMinBlockSize << (kClassCount - 1);
+    static constexpr size_t kMaxCachedBlocks = 8;
+
+    //     bytes    operator new
+    static void* Allocate(size_t bytes) {
+        if (bytes > kMaxBlockSize)
+            return ::operator new(bytes);
+        const size_t index = ClassIndex(bytes);
+        if (!destroyed_) {
+            FreeLists& lists = Local();
+            if (FreeBlock* block = lists.heads[index]) {
+                lists.heads[index] = block->next;
+                --lists.counts[index];
+                if constexpr (kSimpleVectorStatsEnabled)
+                    SimpleVectorStatsRegistry::OnPoolHit();
+                return block;
+            }
+        }
+        if constexpr (kSimpleVectorStatsEnabled)
+            SimpleVectorStatsRegistry::OnPoolMiss();
+        return ::operator new(kMinBlockSize << index);
+    }
+
+    //    ,   Allocate(bytes)
+    static void Deallocate(void* ptr, size_t bytes) noexcept {
+        if (bytes <= kMaxBlockSize && !destroyed_) {
+            FreeLists& lists = Local();
+            const size_t index = ClassIndex(bytes);
+            if (lists.counts[index] < kMaxCachedBlocks) {
+                lists.heads[index] = new (ptr) FreeBlock{ lists.heads[index] };
+                ++lists.counts[index];
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
+    //      
+    static void Trim() noexcept {
+        if (!destroyed_)
+            Local().Release();
+    }
+
+    //         
+    static size_t GetCachedBytes() noexcept {
+        if (destroyed_)
+            return 0;
+        const FreeLists& lists = Local();
+        size_t bytes = 0;
+        for (size_t index = 0; index < kClassCount; ++index) {
+            bytes += lists.counts[index] * (kMinBlockSize << index);
+        }
+        return bytes;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct FreeLists {
+        FreeBlock* heads[kClassCount] = {};
+        size_t counts[kClassCount] = {};
+
+        void Release() noexcept {
+            for (size_t index = 0; index < kClassCount; ++index) {
+                while (FreeBlock* block = heads[index]) {
+                    heads[index] = block->next;
+                    ::operator delete(block);
+                }
+                counts[index] = 0;
+            }
+        }
+
+        // ,    (, ),   
+        ~FreeLists() {
+            Release();
+            destroyed_ = true;
+        }
+    };
+
+    //   ,  bytes 
+    static size_t ClassIndex(size_t bytes) noexcept {
+        if (bytes <= kMinBlockSize)
+            return 0;
+        return FloorLog2(bytes - 1) + 1 - FloorLog2(kMinBlockSize);
+    }
+
+    static FreeLists& Local() noexcept {
+        thread_local FreeLists lists;
+        return lists;
+    }
+
+    static inline thread_local bool destroyed_ = false;
+};
+
+// ,    ThreadBufferPool: ,     
+//   ,        .
+//  ,   
+template <typename Type>
+class PooledAllocator {
+    static_assert(alignof(Type) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "operator new does not guarantee such alignment");
+
+public:
+    using value_type = Type;
+
+    PooledAllocator() noexcept = default;
+
+    template <typename Other>
+    PooledAllocator(const PooledAllocator<Other>&) noexcept {
+    }
+
+    Type* allocate(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(Type))
+            throw std::bad_array_new_length();
+        return static_cast<Type*>(ThreadBufferPool::Allocate(n * sizeof(Type)));
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept {
+        ThreadBufferPool::Deallocate(ptr, n * sizeof(Type));
+    }
+
+    template <typename Other>
+    bool operator==(const PooledAllocator<Other>&) const noexcept {
+        return true;
+    }
+
+    template <typename Other>
+    bool operator!=(const PooledAllocator<Other>&) const noexcept {
+        return false;
+    }
+};
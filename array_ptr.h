@@ -1,23 +1,108 @@
 #pragma once
 
+#include <cassert>
 #include <cstdlib>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
-template <typename Type>
-class ArrayPtr {
+#include "constexpr_support.h"
+
+//  .   ( std::allocator)    
+//    
+template <typename Alloc, bool = std::is_empty_v<Alloc> && !std::is_final_v<Alloc>>
+class AllocatorHolder : private Alloc {
+public:
+    AllocatorHolder() = default;
+
+    SIMPLE_VECTOR_CONSTEXPR explicit AllocatorHolder(const Alloc& alloc) noexcept
+        :Alloc(alloc)
+    {
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR Alloc& GetAlloc() noexcept {
+        return *this;
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR const Alloc& GetAlloc() const noexcept {
+        return *this;
+    }
+};
+
+template <typename Alloc>
+class AllocatorHolder<Alloc, false> {
 public:
+    AllocatorHolder() = default;
+
+    SIMPLE_VECTOR_CONSTEXPR explicit AllocatorHolder(const Alloc& alloc) noexcept
+        :alloc_(alloc)
+    {
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR Alloc& GetAlloc() noexcept {
+        return alloc_;
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR const Alloc& GetAlloc() const noexcept {
+        return alloc_;
+    }
+
+private:
+    Alloc alloc_{};
+};
+
+// ,        : Type* reallocate(Type* ptr, size_t old_n, size_t new_n)
+template <typename Alloc, typename = void>
+struct HasReallocate : std::false_type {
+};
+
+template <typename Alloc>
+struct HasReallocate<Alloc, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+    std::declval<typename std::allocator_traits<Alloc>::pointer>(), size_t{}, size_t{}))>> : std::true_type {
+};
+
+template <typename Alloc>
+inline constexpr bool HasReallocateV = HasReallocate<Alloc>::value;
+
+//   ()    size   Type,
+//    Alloc.
+// ArrayPtr      :    (SimpleVector),
+//        Type
+template <typename Type, typename Alloc = std::allocator<Type>>
+class ArrayPtr : private AllocatorHolder<Alloc> {
+    using AllocTraits = std::allocator_traits<Alloc>;
+    using Holder = AllocatorHolder<Alloc>;
+
+    static_assert(std::is_same_v<typename AllocTraits::value_type, Type>, "Allocator must be rebound to Type");
+    static_assert(std::is_same_v<typename AllocTraits::pointer, Type*>, "Fancy pointers are not supported");
+
+public:
+    using AllocatorType = Alloc;
+
     //  ArrayPtr  
     ArrayPtr() = default;
 
-    //      size   Type.
+    //  ArrayPtr     
+    SIMPLE_VECTOR_CONSTEXPR explicit ArrayPtr(const Alloc& alloc) noexcept
+        :Holder(alloc)
+    {
+    }
+
+    //      size   Type,   .
     //  size == 0,  raw_ptr_    nullptr
-    explicit ArrayPtr(size_t size) {
-        if (size > 0)
-            raw_ptr_ = new Type[size];
+    SIMPLE_VECTOR_CONSTEXPR explicit ArrayPtr(size_t size, const Alloc& alloc = Alloc())
+        :Holder(alloc)
+    {
+        if (size > 0) {
+            raw_ptr_ = AllocTraits::allocate(GetAllocator(), size);
+            size_ = size;
+        }
     }
 
-    //    ,       nullptr
-    explicit ArrayPtr(Type* raw_ptr) noexcept
-        :raw_ptr_(raw_ptr)
+    //        size ,    alloc
+    // (,  ArrayPtr::Release()),  nullptr
+    SIMPLE_VECTOR_CONSTEXPR ArrayPtr(Type* raw_ptr, size_t size, const Alloc& alloc = Alloc()) noexcept
+        :Holder(alloc), raw_ptr_(raw_ptr), size_(raw_ptr ? size : 0)
     {
     }
 
@@ -26,54 +111,110 @@ public:
     //  
     ArrayPtr& operator=(const ArrayPtr&) = delete;
 
-    ArrayPtr(ArrayPtr&& other) noexcept {
-        this->raw_ptr_ = other.raw_ptr_;
-        other.raw_ptr_ = nullptr;
+    SIMPLE_VECTOR_CONSTEXPR ArrayPtr(ArrayPtr&& other) noexcept
+        :Holder(std::move(other.GetAllocator()))
+    {
+        this->raw_ptr_ = std::exchange(other.raw_ptr_, nullptr);
+        this->size_ = std::exchange(other.size_, 0);
     };
-    ArrayPtr& operator=(ArrayPtr&& other) noexcept {
-        if (this->raw_ptr_ == other.raw_ptr_)
+    //       other.
+    //     ,     propagate_on_container_move_assignment,
+    //     
+    SIMPLE_VECTOR_CONSTEXPR ArrayPtr& operator=(ArrayPtr&& other) noexcept {
+        if (this == &other)
             return *this;
-        std::swap(this->raw_ptr_, other.raw_ptr_);
+        Deallocate();
+        if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+            GetAllocator() = std::move(other.GetAllocator());
+        else
+            assert(GetAllocator() == other.GetAllocator());
+        this->raw_ptr_ = std::exchange(other.raw_ptr_, nullptr);
+        this->size_ = std::exchange(other.size_, 0);
         return *this;
     }
 
-    ~ArrayPtr() {
-        delete[] raw_ptr_;
+    //  .        
+    SIMPLE_VECTOR_CONSTEXPR ~ArrayPtr() {
+        Deallocate();
     }
 
     //     ,    
     //        
-    [[nodiscard]] Type* Release() noexcept {
-        Type* temp = raw_ptr_;
-        raw_ptr_ = nullptr;
-        return temp;
+    [[nodiscard]] SIMPLE_VECTOR_CONSTEXPR Type* Release() noexcept {
+        size_ = 0;
+        return std::exchange(raw_ptr_, nullptr);
     }
 
     //        index
-    Type& operator[](size_t index) noexcept {
+    SIMPLE_VECTOR_CONSTEXPR Type& operator[](size_t index) noexcept {
         return *(raw_ptr_ + index);
     }
 
     //         index
-    const Type& operator[](size_t index) const noexcept {
-        return *(raw_ptr_ + index);;
+    SIMPLE_VECTOR_CONSTEXPR const Type& operator[](size_t index) const noexcept {
+        return *(raw_ptr_ + index);
     }
 
     //  true,   ,  false   
-    explicit operator bool() const {
+    SIMPLE_VECTOR_CONSTEXPR explicit operator bool() const {
         return raw_ptr_;
     }
 
     //    ,    
-    Type* Get() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR Type* Get() const noexcept {
         return raw_ptr_;
     }
 
-    //        other
-    void swap(ArrayPtr& other) noexcept {
-        std::swap(this->raw_ptr_, other.raw_ptr_);
+    //      Alloc::reallocate,   .
+    //  false,          .
+    //      :     
+    SIMPLE_VECTOR_CONSTEXPR bool Reallocate(size_t new_size) {
+        if constexpr (HasReallocateV<Alloc>) {
+            if (!raw_ptr_ || new_size == 0)
+                return false;
+            raw_ptr_ = GetAllocator().reallocate(raw_ptr_, size_, new_size);
+            size_ = new_size;
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    //   ,    
+    SIMPLE_VECTOR_CONSTEXPR size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR Alloc& GetAllocator() noexcept {
+        return Holder::GetAlloc();
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR const Alloc& GetAllocator() const noexcept {
+        return Holder::GetAlloc();
+    }
+
+    //        other.
+    //  ,     propagate_on_container_swap,
+    //     
+    SIMPLE_VECTOR_CONSTEXPR void swap(ArrayPtr& other) noexcept {
+        using std::swap;
+        if constexpr (AllocTraits::propagate_on_container_swap::value)
+            swap(GetAllocator(), other.GetAllocator());
+        else
+            assert(GetAllocator() == other.GetAllocator());
+        swap(this->raw_ptr_, other.raw_ptr_);
+        swap(this->size_, other.size_);
     }
 
 private:
+    SIMPLE_VECTOR_CONSTEXPR void Deallocate() noexcept {
+        if (raw_ptr_)
+            AllocTraits::deallocate(GetAllocator(), raw_ptr_, size_);
+        raw_ptr_ = nullptr;
+        size_ = 0;
+    }
+
     Type* raw_ptr_ = nullptr;
+    size_t size_ = 0;
 };
\ No newline at end of file
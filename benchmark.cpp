@@ -0,0 +1,308 @@
+#include "simple_vector.h"
+#include "test_types.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//  SimpleVector    std::vector.
+//    stdout   CSV:
+// container,type,operation,size,iterations,ns_per_op
+// : benchmark [--max-size N] [--min-size N],     8  10^8
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+//       
+volatile size_t sink = 0;
+
+template <typename Type>
+Type MakeValue(size_t i);
+
+template <>
+int MakeValue<int>(size_t i) {
+    return static_cast<int>(i);
+}
+
+template <>
+X MakeValue<X>(size_t i) {
+    return X(i);
+}
+
+//  ,     small string optimization
+template <>
+std::string MakeValue<std::string>(size_t i) {
+    return std::string(64, static_cast<char>('a' + i % 26));
+}
+
+template <typename Type>
+const char* TypeName();
+
+template <>
+const char* TypeName<int>() {
+    return "int";
+}
+
+template <>
+const char* TypeName<X>() {
+    return "X";
+}
+
+template <>
+const char* TypeName<std::string>() {
+    return "string64";
+}
+
+//     
+template <typename Type>
+struct SimpleVectorOps {
+    using Container = SimpleVector<Type>;
+
+    static const char* Name() {
+        return "SimpleVector";
+    }
+
+    static void PushBack(Container& v, Type&& value) {
+        v.PushBack(std::move(value));
+    }
+
+    static void Reserve(Container& v, size_t capacity) {
+        v.Reserve(capacity);
+    }
+
+    static void Resize(Container& v, size_t size) {
+        v.Resize(size);
+    }
+
+    static void Insert(Container& v, size_t index, Type&& value) {
+        v.Insert(v.begin() + index, std::move(value));
+    }
+
+    static void Erase(Container& v, size_t index) {
+        v.Erase(v.begin() + index);
+    }
+
+    static size_t Size(const Container& v) {
+        return v.GetSize();
+    }
+};
+
+template <typename Type>
+struct StdVectorOps {
+    using Container = std::vector<Type>;
+
+    static const char* Name() {
+        return "std::vector";
+    }
+
+    static void PushBack(Container& v, Type&& value) {
+        v.push_back(std::move(value));
+    }
+
+    static void Reserve(Container& v, size_t capacity) {
+        v.reserve(capacity);
+    }
+
+    static void Resize(Container& v, size_t size) {
+        v.resize(size);
+    }
+
+    static void Insert(Container& v, size_t index, Type&& value) {
+        v.insert(v.begin() + index, std::move(value));
+    }
+
+    static void Erase(Container& v, size_t index) {
+        v.erase(v.begin() + index);
+    }
+
+    static size_t Size(const Container& v) {
+        return v.size();
+    }
+};
+
+//          ,
+//        
+constexpr size_t kEditOperations = 64;
+
+//    ,       kMinWork 
+constexpr size_t kMinWork = 1 << 22;
+constexpr size_t kMaxRepeats = 100;
+
+//   64   10^8     10   ,     
+constexpr size_t kMaxHeavySize = 10'000'000;
+
+void Report(const char* container, const char* type, const char* operation, size_t size,
+    size_t iterations, double ns_per_op) {
+    std::cout << container << ',' << type << ',' << operation << ',' << size << ','
+        << iterations << ',' << ns_per_op << '\n';
+}
+
+//  prepare ( )  run ()  ,     
+template <typename Prepare, typename Run>
+void Measure(const char* container, const char* type, const char* operation, size_t size,
+    size_t ops_per_run, Prepare prepare, Run run) {
+    const size_t repeats = std::clamp<size_t>(kMinWork / size, 1, kMaxRepeats);
+    double best = 0.0;
+    for (size_t i = 0; i < repeats; ++i) {
+        auto state = prepare();
+        const auto start = Clock::now();
+        run(state);
+        const auto finish = Clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+        if (i == 0 || ns < best)
+            best = ns;
+    }
+    Report(container, type, operation, size, repeats, best / static_cast<double>(ops_per_run));
+}
+
+template <typename Ops>
+typename Ops::Container Filled(size_t size) {
+    using Type = std::remove_reference_t<decltype(*std::declval<typename Ops::Container&>().begin())>;
+    typename Ops::Container v;
+    Ops::Reserve(v, size);
+    for (size_t i = 0; i < size; ++i) {
+        Ops::PushBack(v, MakeValue<Type>(i));
+    }
+    return v;
+}
+
+template <typename Ops, typename Type>
+void RunSuite(size_t size) {
+    using Container = typename Ops::Container;
+    const char* name = Ops::Name();
+    const char* type = TypeName<Type>();
+
+    Measure(name, type, "push_back", size, size,
+        [] { return Container(); },
+        [size](Container& v) {
+            for (size_t i = 0; i < size; ++i) {
+                Ops::PushBack(v, MakeValue<Type>(i));
+            }
+            sink = sink + Ops::Size(v);
+        });
+
+    //      :      
+    if constexpr (std::is_same_v<Container, SimpleVector<Type>>) {
+        Measure(name, type, "back_inserter", size, size,
+            [] { return Container(); },
+            [size](Container& v) {
+                {
+                    typename Container::BackInserter writer(v);
+                    for (size_t i = 0; i < size; ++i) {
+                        writer.PushBack(MakeValue<Type>(i));
+                    }
+                }
+                sink = sink + Ops::Size(v);
+            });
+    }
+
+    //        
+    Measure(name, type, "reserve", size, size,
+        [size] { return Filled<Ops>(size); },
+        [size](Container& v) {
+            Ops::Reserve(v, size * 2);
+            sink = sink + Ops::Size(v);
+        });
+
+    Measure(name, type, "resize", size, size,
+        [] { return Container(); },
+        [size](Container& v) {
+            Ops::Resize(v, size);
+            sink = sink + Ops::Size(v);
+        });
+
+    struct Position {
+        const char* insert_name;
+        const char* erase_name;
+        int where;
+    };
+    const Position positions[] = {
+        { "insert_front", "erase_front", 0 },
+        { "insert_middle", "erase_middle", 1 },
+        { "insert_back", "erase_back", 2 },
+    };
+    for (const Position& position : positions) {
+        auto index_of = [where = position.where](size_t current_size) -> size_t {
+            return where == 0 ? 0 : where == 1 ? current_size / 2 : current_size;
+        };
+        Measure(name, type, position.insert_name, size, kEditOperations,
+            [size] { return Filled<Ops>(size); },
+            [&index_of](Container& v) {
+                for (size_t i = 0; i < kEditOperations; ++i) {
+                    Ops::Insert(v, index_of(Ops::Size(v)), MakeValue<Type>(i));
+                }
+                sink = sink + Ops::Size(v);
+            });
+        Measure(name, type, position.erase_name, size, kEditOperations,
+            [size] { return Filled<Ops>(size + kEditOperations); },
+            [&index_of](Container& v) {
+                for (size_t i = 0; i < kEditOperations; ++i) {
+                    const size_t current_size = Ops::Size(v);
+                    Ops::Erase(v, std::min(index_of(current_size), current_size - 1));
+                }
+                sink = sink + Ops::Size(v);
+            });
+    }
+
+    if constexpr (std::is_copy_constructible_v<Type>) {
+        const Container source = Filled<Ops>(size);
+        Measure(name, type, "copy", size, size,
+            [] { return 0; },
+            [&source](int&) {
+                Container copy(source);
+                sink = sink + Ops::Size(copy);
+            });
+    }
+
+    Measure(name, type, "move", size, 1,
+        [size] { return Filled<Ops>(size); },
+        [](Container& v) {
+            Container moved(std::move(v));
+            sink = sink + Ops::Size(moved);
+        });
+}
+
+//    10   min_size,    max_size
+template <typename Type>
+void RunForType(size_t min_size, size_t max_size) {
+    for (size_t size = min_size;; size = std::min(size * 10, max_size)) {
+        RunSuite<SimpleVectorOps<Type>, Type>(size);
+        RunSuite<StdVectorOps<Type>, Type>(size);
+        std::cout.flush();
+        if (size == max_size)
+            break;
+    }
+}
+
+} // namespace bench
+
+int main(int argc, char** argv) {
+    size_t min_size = 8;
+    size_t max_size = 100'000'000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--max-size") == 0) {
+            max_size = std::strtoull(argv[i + 1], nullptr, 10);
+        }
+        else if (std::strcmp(argv[i], "--min-size") == 0) {
+            min_size = std::strtoull(argv[i + 1], nullptr, 10);
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--min-size N] [--max-size N]" << std::endl;
+            return 1;
+        }
+    }
+    if (min_size == 0 || min_size > max_size) {
+        std::cerr << "Invalid size range" << std::endl;
+        return 1;
+    }
+
+    std::cout << "container,type,operation,size,iterations,ns_per_op\n";
+    bench::RunForType<int>(min_size, max_size);
+    bench::RunForType<X>(min_size, max_size);
+    bench::RunForType<std::string>(std::min(min_size, bench::kMaxHeavySize), std::min(max_size, bench::kMaxHeavySize));
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,313 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define SIMPLE_VECTOR_HAS_COROUTINES 1
+#else
+#define SIMPLE_VECTOR_HAS_COROUTINES 0
+#endif
+
+//         .
+//    buffer_count   buffer_capacity;     :
+//     (Acquire),    (Publish),    (Consume)
+//     (Release),      .
+//    swap,        .
+//   . Acquire  Consume  ;  C++20   co_await-
+// AcquireAsync  ConsumeAsync,        ,
+//  Release  Publish.       .
+// Close   : Consume     std::nullopt.
+//        ;      
+template <typename Type, typename Alloc = std::allocator<Type>, typename Growth = GrowthDouble>
+class BufferQueue {
+public:
+    using Buffer = SimpleVector<Type, Alloc, Growth>;
+    using AllocatorType = typename Buffer::AllocatorType;
+
+    BufferQueue(size_t buffer_count, size_t buffer_capacity, const AllocatorType& alloc = AllocatorType())
+        :buffer_capacity_(buffer_capacity), alloc_(alloc), free_(buffer_count, Buffer(alloc)), ready_(buffer_count, Buffer(alloc))
+    {
+        if (buffer_count == 0)
+            throw std::invalid_argument("BufferQueue needs at least one buffer");
+        for (Buffer& buffer : free_) {
+            buffer.Reserve(buffer_capacity);
+        }
+        free_count_ = buffer_count;
+    }
+
+    BufferQueue(const BufferQueue&) = delete;
+    BufferQueue& operator=(const BufferQueue&) = delete;
+
+    //  ,   
+    size_t GetBufferCount() const noexcept {
+        return free_.GetSize();
+    }
+
+    // ,     
+    size_t GetBufferCapacity() const noexcept {
+        return buffer_capacity_;
+    }
+
+    //     , ,      
+    Buffer Acquire() {
+        std::unique_lock lock(mutex_);
+        free_cv_.wait(lock, [this] { return free_count_ > 0; });
+        return TakeFree();
+    }
+
+    //   ,      
+    bool TryAcquire(Buffer& buffer) {
+        std::lock_guard lock(mutex_);
+        if (free_count_ == 0)
+            return false;
+        buffer = TakeFree();
+        return true;
+    }
+
+    //      , buffer     
+    void Publish(Buffer&& buffer) {
+        std::unique_lock lock(mutex_);
+#if SIMPLE_VECTOR_HAS_COROUTINES
+        if (Waiter* waiter = PopWaiter(consume_waiters_)) {
+            waiter->buffer.swap(buffer);
+            waiter->filled = true;
+            lock.unlock();
+            waiter->handle.resume();
+            return;
+        }
+#endif
+        if (ready_count_ == ready_.GetSize())
+            throw std::logic_error("BufferQueue received a buffer it does not own");
+        ready_[(ready_head_ + ready_count_) % ready_.GetSize()].swap(buffer);
+        ++ready_count_;
+        lock.unlock();
+        ready_cv_.notify_one();
+    }
+
+    //     ,  .
+    //  std::nullopt,     
+    std::optional<Buffer> Consume() {
+        std::unique_lock lock(mutex_);
+        ready_cv_.wait(lock, [this] { return ready_count_ > 0 || closed_; });
+        if (ready_count_ == 0)
+            return std::nullopt;
+        return TakeReady();
+    }
+
+    //   ,    
+    bool TryConsume(Buffer& buffer) {
+        std::lock_guard lock(mutex_);
+        if (ready_count_ == 0)
+            return false;
+        buffer = TakeReady();
+        return true;
+    }
+
+    //    .  ,  
+    void Release(Buffer&& buffer) {
+        buffer.Clear();
+        if (buffer.GetCapacity() < buffer_capacity_)
+            buffer.Reserve(buffer_capacity_);
+        std::unique_lock lock(mutex_);
+#if SIMPLE_VECTOR_HAS_COROUTINES
+        if (Waiter* waiter = PopWaiter(acquire_waiters_)) {
+            waiter->buffer.swap(buffer);
+            lock.unlock();
+            waiter->handle.resume();
+            return;
+        }
+#endif
+        if (free_count_ == free_.GetSize())
+            throw std::logic_error("BufferQueue received a buffer it does not own");
+        free_[free_count_++].swap(buffer);
+        lock.unlock();
+        free_cv_.notify_one();
+    }
+
+    //    :      ,
+    //   Consume  ConsumeAsync  std::nullopt
+    void Close() {
+        std::unique_lock lock(mutex_);
+        closed_ = true;
+#if SIMPLE_VECTOR_HAS_COROUTINES
+        Waiter* waiters = std::exchange(consume_waiters_.head, nullptr);
+        consume_waiters_.tail = nullptr;
+        lock.unlock();
+        ready_cv_.notify_all();
+        while (waiters) {
+            //  resume     
+            Waiter* next = waiters->next;
+            waiters->handle.resume();
+            waiters = next;
+        }
+#else
+        lock.unlock();
+        ready_cv_.notify_all();
+#endif
+    }
+
+    bool IsClosed() const {
+        std::lock_guard lock(mutex_);
+        return closed_;
+    }
+
+#if SIMPLE_VECTOR_HAS_COROUTINES
+private:
+    //     ;    ,     
+    struct Waiter {
+        std::coroutine_handle<> handle;
+        Buffer buffer;
+        Waiter* next = nullptr;
+        //   ,     
+        bool filled = false;
+    };
+
+    struct WaiterList {
+        Waiter* head = nullptr;
+        Waiter* tail = nullptr;
+    };
+
+public:
+    //  AcquireAsync: co_await     
+    class AcquireAwaiter {
+    public:
+        explicit AcquireAwaiter(BufferQueue& queue) noexcept
+            :queue_(queue), waiter_{ {}, Buffer(queue.alloc_) }
+        {
+        }
+
+        bool await_ready() {
+            return queue_.TryAcquire(waiter_.buffer);
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            std::lock_guard lock(queue_.mutex_);
+            if (queue_.free_count_ > 0) {
+                waiter_.buffer = queue_.TakeFree();
+                return false;
+            }
+            waiter_.handle = handle;
+            PushWaiter(queue_.acquire_waiters_, waiter_);
+            return true;
+        }
+
+        Buffer await_resume() noexcept {
+            return std::move(waiter_.buffer);
+        }
+
+    private:
+        BufferQueue& queue_;
+        Waiter waiter_;
+    };
+
+    //  ConsumeAsync: co_await     std::nullopt  Close
+    class ConsumeAwaiter {
+    public:
+        explicit ConsumeAwaiter(BufferQueue& queue) noexcept
+            :queue_(queue), waiter_{ {}, Buffer(queue.alloc_) }
+        {
+        }
+
+        bool await_ready() {
+            std::lock_guard lock(queue_.mutex_);
+            return TakeLocked();
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            std::lock_guard lock(queue_.mutex_);
+            if (TakeLocked())
+                return false;
+            waiter_.handle = handle;
+            PushWaiter(queue_.consume_waiters_, waiter_);
+            return true;
+        }
+
+        std::optional<Buffer> await_resume() noexcept {
+            if (!waiter_.filled)
+                return std::nullopt;
+            return std::optional<Buffer>(std::move(waiter_.buffer));
+        }
+
+    private:
+        //   ,   ;        
+        bool TakeLocked() {
+            if (queue_.ready_count_ > 0) {
+                waiter_.buffer = queue_.TakeReady();
+                waiter_.filled = true;
+                return true;
+            }
+            return queue_.closed_;
+        }
+
+        BufferQueue& queue_;
+        Waiter waiter_;
+    };
+
+    AcquireAwaiter AcquireAsync() noexcept {
+        return AcquireAwaiter(*this);
+    }
+
+    ConsumeAwaiter ConsumeAsync() noexcept {
+        return ConsumeAwaiter(*this);
+    }
+#endif
+
+private:
+    //   mutex_
+    Buffer TakeFree() noexcept {
+        Buffer buffer(alloc_);
+        buffer.swap(free_[--free_count_]);
+        return buffer;
+    }
+
+    Buffer TakeReady() noexcept {
+        Buffer buffer(alloc_);
+        buffer.swap(ready_[ready_head_]);
+        ready_head_ = (ready_head_ + 1) % ready_.GetSize();
+        --ready_count_;
+        return buffer;
+    }
+
+#if SIMPLE_VECTOR_HAS_COROUTINES
+    static void PushWaiter(WaiterList& list, Waiter& waiter) noexcept {
+        waiter.next = nullptr;
+        if (list.tail)
+            list.tail->next = &waiter;
+        else
+            list.head = &waiter;
+        list.tail = &waiter;
+    }
+
+    static Waiter* PopWaiter(WaiterList& list) noexcept {
+        Waiter* waiter = list.head;
+        if (waiter) {
+            list.head = waiter->next;
+            if (!list.head)
+                list.tail = nullptr;
+        }
+        return waiter;
+    }
+
+    WaiterList acquire_waiters_;
+    WaiterList consume_waiters_;
+#endif
+
+    size_t buffer_capacity_;
+    AllocatorType alloc_;
+    mutable std::mutex mutex_;
+    std::condition_variable free_cv_;
+    std::condition_variable ready_cv_;
+    //   :   free_count_  
+    SimpleVector<Buffer> free_;
+    size_t free_count_ = 0;
+    //  :   ready_count_    ready_head_
+    SimpleVector<Buffer> ready_;
+    size_t ready_head_ = 0;
+    size_t ready_count_ = 0;
+    bool closed_ = false;
+};
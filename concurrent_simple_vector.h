@@ -0,0 +1,227 @@
+#pragma once
+
+#include "simple_vector.h"
+#include "segment_layout.h"
+
+#include <atomic>
+
+//    ,        PushBack  .
+//      ,     
+//  (. segment_layout.h)    ,      .
+//      ,        
+//    . GetSize()      :    ,
+//  PushBack,      GetSize()     
+//   PushBack. Freeze, Clear       PushBack
+template <typename Type, size_t FirstSegment = 64, typename Alloc = std::allocator<Type>>
+class ConcurrentSimpleVector {
+    using AllocTraits = typename std::allocator_traits<Alloc>::template rebind_traits<Type>;
+    using Flag = std::atomic<bool>;
+    using FlagAllocTraits = typename std::allocator_traits<Alloc>::template rebind_traits<Flag>;
+    using Segments = GeometricSegments<FirstSegment>;
+
+public:
+    using AllocatorType = typename AllocTraits::allocator_type;
+
+    ConcurrentSimpleVector() noexcept(noexcept(AllocatorType())) = default;
+
+    //    alloc,       
+    explicit ConcurrentSimpleVector(const AllocatorType& alloc) noexcept
+        :alloc_(alloc)
+    {
+    }
+
+    ConcurrentSimpleVector(const ConcurrentSimpleVector&) = delete;
+    ConcurrentSimpleVector& operator=(const ConcurrentSimpleVector&) = delete;
+
+    ~ConcurrentSimpleVector() {
+        Clear();
+        typename FlagAllocTraits::allocator_type flag_alloc(alloc_);
+        for (size_t segment = 0; segment < Segments::kMaxSegments; ++segment) {
+            if (Type* data = segments_[segment].load(std::memory_order_relaxed))
+                AllocTraits::deallocate(alloc_, data, Segments::Capacity(segment));
+            if (Flag* flags = ready_[segment].load(std::memory_order_relaxed))
+                FlagAllocTraits::deallocate(flag_alloc, flags, Segments::Capacity(segment));
+        }
+    }
+
+    //    
+    size_t GetSize() const noexcept {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    Type& operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        const auto position = Segments::Locate(index);
+        return segments_[position.segment].load(std::memory_order_acquire)[position.offset];
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        const auto position = Segments::Locate(index);
+        return segments_[position.segment].load(std::memory_order_acquire)[position.offset];
+    }
+
+    //       index.
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= GetSize())
+            throw std::out_of_range("Index out of range");
+        return (*this)[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize())
+            throw std::out_of_range("Index out of range");
+        return (*this)[index];
+    }
+
+    //      .     
+    size_t PushBack(const Type& value) {
+        return EmplaceBack(value);
+    }
+
+    size_t PushBack(Type&& value) {
+        return EmplaceBack(std::move(value));
+    }
+
+    //    args   ,  .     .
+    //      .     ,
+    //            ,
+    //            
+    template <typename... Args>
+    size_t EmplaceBack(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<Type, Args&&...>) {
+            const size_t index = Claim();
+            AllocTraits::construct(alloc_, SlotAt(index), std::forward<Args>(args)...);
+            return Publish(index);
+        }
+        else {
+            static_assert(std::is_nothrow_move_constructible_v<Type>,
+                "A throwing constructor needs a nothrow move to fill the reserved slot");
+            Type value(std::forward<Args>(args)...);
+            const size_t index = Claim();
+            AllocTraits::construct(alloc_, SlotAt(index), std::move(value));
+            return Publish(index);
+        }
+    }
+
+    //   ,     
+    void Clear() noexcept {
+        AdvanceSize();
+        const size_t size = size_.load(std::memory_order_relaxed);
+        ForEachRange(size, [this](Type* first, size_t count) {
+            DestroyElements(alloc_, first, first + count);
+        });
+        for (size_t segment = 0; Segments::Start(segment) < size; ++segment) {
+            Flag* flags = ready_[segment].load(std::memory_order_relaxed);
+            const size_t count = std::min(Segments::Capacity(segment), size - Segments::Start(segment));
+            for (size_t i = 0; i < count; ++i) {
+                flags[i].store(false, std::memory_order_relaxed);
+            }
+        }
+        reserved_.store(0, std::memory_order_relaxed);
+        size_.store(0, std::memory_order_relaxed);
+    }
+
+    //     SimpleVector       
+    //    
+    SimpleVector<Type, Alloc> Freeze() {
+        AdvanceSize();
+        const size_t size = size_.load(std::memory_order_acquire);
+        SimpleVector<Type, Alloc> result(Reserve(size), alloc_);
+        ForEachRange(size, [&result](Type* first, size_t count) {
+            result.Append(std::make_move_iterator(first), std::make_move_iterator(first + count));
+        });
+        Clear();
+        return result;
+    }
+
+private:
+    //    .     ,   
+    //  ,        
+    size_t Claim() {
+        size_t index = reserved_.load(std::memory_order_relaxed);
+        do {
+            EnsureSegment(Segments::Locate(index).segment);
+        } while (!reserved_.compare_exchange_weak(index, index + 1));
+        return index;
+    }
+
+    Type* SlotAt(size_t index) const noexcept {
+        const auto position = Segments::Locate(index);
+        return segments_[position.segment].load(std::memory_order_acquire) + position.offset;
+    }
+
+    Flag& FlagAt(size_t index) const noexcept {
+        const auto position = Segments::Locate(index);
+        return ready_[position.segment].load(std::memory_order_acquire)[position.offset];
+    }
+
+    //   index    ,    
+    size_t Publish(size_t index) noexcept {
+        FlagAt(index).store(true);
+        AdvanceSize();
+        return index;
+    }
+
+    //     ,      .
+    //       :   , 
+    //   ,      ,    
+    void AdvanceSize() noexcept {
+        size_t size = size_.load();
+        while (size < reserved_.load() && FlagAt(size).load()) {
+            if (size_.compare_exchange_weak(size, size + 1))
+                ++size;
+        }
+    }
+
+    //   segment     ,  ,    .
+    //    ,  ,   ,   .
+    //      ,   
+    Type* EnsureSegment(size_t segment) {
+        Type* data = segments_[segment].load(std::memory_order_acquire);
+        if (data)
+            return data;
+        EnsureFlags(segment);
+        Type* fresh = AllocTraits::allocate(alloc_, Segments::Capacity(segment));
+        if (segments_[segment].compare_exchange_strong(data, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+            return fresh;
+        AllocTraits::deallocate(alloc_, fresh, Segments::Capacity(segment));
+        return data;
+    }
+
+    void EnsureFlags(size_t segment) {
+        if (ready_[segment].load(std::memory_order_acquire))
+            return;
+        const size_t capacity = Segments::Capacity(segment);
+        typename FlagAllocTraits::allocator_type flag_alloc(alloc_);
+        Flag* fresh = FlagAllocTraits::allocate(flag_alloc, capacity);
+        for (size_t i = 0; i < capacity; ++i) {
+            FlagAllocTraits::construct(flag_alloc, fresh + i, false);
+        }
+        Flag* expected = nullptr;
+        if (!ready_[segment].compare_exchange_strong(expected, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+            FlagAllocTraits::deallocate(flag_alloc, fresh, capacity);
+    }
+
+    //  func(first, count)      size 
+    template <typename Func>
+    void ForEachRange(size_t size, Func func) {
+        for (size_t segment = 0; Segments::Start(segment) < size; ++segment) {
+            const size_t count = std::min(Segments::Capacity(segment), size - Segments::Start(segment));
+            func(segments_[segment].load(std::memory_order_acquire), count);
+        }
+    }
+
+    AllocatorType alloc_;
+    //            
+    std::atomic<size_t> reserved_{ 0 };
+    std::atomic<size_t> size_{ 0 };
+    std::atomic<Type*> segments_[Segments::kMaxSegments] = {};
+    std::atomic<Flag*> ready_[Segments::kMaxSegments] = {};
+};
\ No newline at end of file
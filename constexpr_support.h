@@ -0,0 +1,31 @@
+#pragma once
+
+#include <type_traits>
+#include <memory>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+//  C++20 (      )   ArrayPtr  SimpleVector
+//  SIMPLE_VECTOR_CONSTEXPR    constexpr-:      
+//    .      .
+//   ,   __cplusplus,  MSVC  /Zc:__cplusplus  
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_constexpr_dynamic_alloc) \
+    && defined(__cpp_lib_is_constant_evaluated)
+#define SIMPLE_VECTOR_HAS_CONSTEXPR 1
+#define SIMPLE_VECTOR_CONSTEXPR constexpr
+#else
+#define SIMPLE_VECTOR_HAS_CONSTEXPR 0
+#define SIMPLE_VECTOR_CONSTEXPR
+#endif
+
+// true     :   memcpy, memcmp,    
+//    ,      
+constexpr bool IsConstantEvaluated() noexcept {
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+    return std::is_constant_evaluated();
+#else
+    return false;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,347 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <atomic>
+
+//     .       ,
+//    O(1).       
+//  :   operator[], At, begin/end, PushBack   .
+//         cbegin/cend.
+//    ,   ,      :
+//      ,        
+// ( Clear).         ,       
+template <typename Type, typename Alloc = std::allocator<Type>>
+class CowSimpleVector {
+    static_assert(std::is_copy_constructible_v<Type>, "Copy-on-write requires copyable elements");
+
+public:
+    using VectorType = SimpleVector<Type, Alloc>;
+    using AllocatorType = typename VectorType::AllocatorType;
+    using Iterator = typename VectorType::Iterator;
+    using ConstIterator = typename VectorType::ConstIterator;
+
+    CowSimpleVector() noexcept = default;
+
+    //   ,      alloc
+    explicit CowSimpleVector(const AllocatorType& alloc)
+        :data_(new Shared(alloc))
+    {
+    }
+
+    //    size ,    
+    explicit CowSimpleVector(size_t size, const AllocatorType& alloc = AllocatorType())
+        :data_(new Shared(size, alloc))
+    {
+    }
+
+    //    size ,   value
+    CowSimpleVector(size_t size, const Type& value, const AllocatorType& alloc = AllocatorType())
+        :data_(new Shared(size, value, alloc))
+    {
+    }
+
+    //    std::initializer_list
+    CowSimpleVector(std::initializer_list<Type> init, const AllocatorType& alloc = AllocatorType())
+        :data_(new Shared(init, alloc))
+    {
+    }
+
+    //      [first, last)
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    CowSimpleVector(InputIt first, InputIt last, const AllocatorType& alloc = AllocatorType())
+        :data_(new Shared(first, last, alloc))
+    {
+    }
+
+    //      
+    explicit CowSimpleVector(VectorType&& vector)
+        :data_(new Shared(std::move(vector)))
+    {
+    }
+
+    //   other,    
+    CowSimpleVector(const CowSimpleVector& other) {
+        if (!other.data_)
+            return;
+        if (other.data_->unshareable) {
+            data_ = Duplicate(other.data_->vector, 0);
+        }
+        else {
+            other.data_->refs.fetch_add(1, std::memory_order_relaxed);
+            data_ = other.data_;
+        }
+    }
+
+    CowSimpleVector(CowSimpleVector&& other) noexcept
+        :data_(std::exchange(other.data_, nullptr))
+    {
+    }
+
+    CowSimpleVector& operator=(const CowSimpleVector& rhs) {
+        if (this != &rhs) {
+            CowSimpleVector temp(rhs);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    CowSimpleVector& operator=(CowSimpleVector&& other) noexcept {
+        if (this != &other) {
+            ReleaseData();
+            data_ = std::exchange(other.data_, nullptr);
+        }
+        return *this;
+    }
+
+    ~CowSimpleVector() {
+        ReleaseData();
+    }
+
+    //   ,     
+    AllocatorType GetAllocator() const noexcept {
+        return View().GetAllocator();
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return View().GetSize();
+    }
+
+    //   
+    size_t GetCapacity() const noexcept {
+        return View().GetCapacity();
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return View().IsEmpty();
+    }
+
+    // ,       
+    bool IsShared() const noexcept {
+        return data_ && data_->refs.load(std::memory_order_acquire) > 1;
+    }
+
+    //       
+    const VectorType& View() const noexcept {
+        return data_ ? data_->vector : EmptyVector();
+    }
+
+    //       index,    
+    Type& operator[](size_t index) {
+        return Unshareable()[index];
+    }
+
+    //        index
+    const Type& operator[](size_t index) const noexcept {
+        return View()[index];
+    }
+
+    //       index.
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= GetSize())
+            throw std::out_of_range("Index out of range");
+        return Unshareable()[index];
+    }
+
+    //        index.
+    //   std::out_of_range,  index >= size
+    const Type& At(size_t index) const {
+        return View().At(index);
+    }
+
+    //   .    ,     
+    void Clear() noexcept {
+        if (IsShared()) {
+            ReleaseData();
+        }
+        else if (data_) {
+            data_->vector.Clear();
+            //       ,     
+            data_->unshareable = false;
+        }
+    }
+
+    //   .
+    //         
+    void Resize(size_t new_size) {
+        Mutable(new_size > GetSize() ? new_size - GetSize() : 0).Resize(new_size);
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > GetCapacity())
+            Mutable(new_capacity - GetSize()).Reserve(new_capacity);
+    }
+
+    //    EmplaceBack   ,    
+    void PushBack(const Type& value) {
+        Mutable(1).EmplaceBack(value);
+    }
+
+    void PushBack(Type&& value) {
+        Mutable(1).EmplaceBack(std::move(value));
+    }
+
+    //    args   
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        Type& item = Mutable(1).EmplaceBack(std::forward<Args>(args)...);
+        data_->unshareable = true;
+        return item;
+    }
+
+    // ""   .     
+    void PopBack() {
+        Mutable().PopBack();
+    }
+
+    //   value   pos.
+    //     
+    Iterator Insert(ConstIterator pos, const Type& value) {
+        const size_t index = pos - cbegin();
+        VectorType& vector = Mutable(1);
+        const Iterator it = vector.Insert(vector.cbegin() + index, value);
+        data_->unshareable = true;
+        return it;
+    }
+
+    Iterator Insert(ConstIterator pos, Type&& value) {
+        const size_t index = pos - cbegin();
+        VectorType& vector = Mutable(1);
+        const Iterator it = vector.Insert(vector.cbegin() + index, std::move(value));
+        data_->unshareable = true;
+        return it;
+    }
+
+    //      
+    Iterator Erase(ConstIterator pos) {
+        const size_t index = pos - cbegin();
+        VectorType& vector = Unshareable();
+        return vector.Erase(vector.cbegin() + index);
+    }
+
+    //     
+    void swap(CowSimpleVector& other) noexcept {
+        std::swap(data_, other.data_);
+    }
+
+    //      
+    Iterator begin() {
+        return Unshareable().begin();
+    }
+
+    Iterator end() {
+        return Unshareable().end();
+    }
+
+    ConstIterator begin() const noexcept {
+        return View().begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return View().end();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return View().cbegin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return View().cend();
+    }
+
+private:
+    //     ,   .
+    //       ,       
+    struct Shared {
+        template <typename... Args>
+        explicit Shared(Args&&... args)
+            :vector(std::forward<Args>(args)...)
+        {
+        }
+
+        VectorType vector;
+        std::atomic<size_t> refs{ 1 };
+        bool unshareable = false;
+    };
+
+    static const VectorType& EmptyVector() noexcept {
+        static const VectorType empty;
+        return empty;
+    }
+
+    //   source      extra,
+    //        
+    static Shared* Duplicate(const VectorType& source, size_t extra) {
+        auto copy = std::make_unique<Shared>(
+            std::allocator_traits<AllocatorType>::select_on_container_copy_construction(source.GetAllocator()));
+        copy->vector.Reserve(std::max(source.GetSize() + extra, source.GetCapacity()));
+        copy->vector.Append(source.begin(), source.end());
+        return copy.release();
+    }
+
+    //   ;    .
+    //      ,     
+    void ReleaseData() noexcept {
+        Shared* data = std::exchange(data_, nullptr);
+        if (data && data->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete data;
+    }
+
+    //  ,     ,   .
+    //    acquire:       ,   
+    //     .           
+    //    ,      load  
+    VectorType& Mutable(size_t extra = 0) {
+        if (!data_) {
+            data_ = new Shared();
+        }
+        else if (data_->refs.load(std::memory_order_acquire) > 1) {
+            Shared* copy = Duplicate(data_->vector, extra);
+            ReleaseData();
+            data_ = copy;
+        }
+        return data_->vector;
+    }
+
+    //  Mutable,       :     
+    VectorType& Unshareable() {
+        VectorType& vector = Mutable();
+        data_->unshareable = true;
+        return vector;
+    }
+
+    Shared* data_ = nullptr;
+};
+
+template <typename Type, typename Alloc>
+inline bool operator==(const CowSimpleVector<Type, Alloc>& lhs, const CowSimpleVector<Type, Alloc>& rhs) {
+    return lhs.View() == rhs.View();
+}
+
+template <typename Type, typename Alloc>
+inline bool operator!=(const CowSimpleVector<Type, Alloc>& lhs, const CowSimpleVector<Type, Alloc>& rhs) {
+    return lhs.View() != rhs.View();
+}
+
+template <typename Type, typename Alloc>
+inline bool operator<(const CowSimpleVector<Type, Alloc>& lhs, const CowSimpleVector<Type, Alloc>& rhs) {
+    return lhs.View() < rhs.View();
+}
+
+template <typename Type, typename Alloc>
+inline bool operator<=(const CowSimpleVector<Type, Alloc>& lhs, const CowSimpleVector<Type, Alloc>& rhs) {
+    return lhs.View() <= rhs.View();
+}
+
+template <typename Type, typename Alloc>
+inline bool operator>(const CowSimpleVector<Type, Alloc>& lhs, const CowSimpleVector<Type, Alloc>& rhs) {
+    return lhs.View() > rhs.View();
+}
+
+template <typename Type, typename Alloc>
+inline bool operator>=(const CowSimpleVector<Type, Alloc>& lhs, const CowSimpleVector<Type, Alloc>& rhs) {
+    return lhs.View() >= rhs.View();
+}
\ No newline at end of file
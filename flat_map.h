@@ -0,0 +1,379 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <functional>
+#include <tuple>
+
+//    [first, first + count),   less(element, key) .
+//       (    cmov),
+//       ,       count
+template <typename Type, typename Key, typename Less>
+const Type* BranchlessLowerBound(const Type* first, size_t count, const Key& key, Less less) {
+    if (count == 0)
+        return first;
+    while (count > 1) {
+        const size_t half = count / 2;
+        first = less(first[half], key) ? first + half : first;
+        count -= half;
+    }
+    return first + (less(*first, key) ? 1 : 0);
+}
+
+//    ,        
+struct SortedUniqueTag {
+};
+
+inline constexpr SortedUniqueTag kSortedUnique{};
+
+//   FlatSet   
+struct FlatIdentityKey {
+    template <typename Type>
+    const Type& operator()(const Type& value) const noexcept {
+        return value;
+    }
+};
+
+//   FlatMap    
+struct FlatFirstKey {
+    template <typename Pair>
+    const auto& operator()(const Pair& pair) const noexcept {
+        return pair.first;
+    }
+};
+
+//   FlatSet  FlatMap:     SimpleVector,    KeyOf()(element).
+//           ,
+//       ,      InsertRange
+template <typename Element, typename Key, typename KeyOf, typename Compare, typename Alloc>
+class FlatSortedBase {
+public:
+    using AllocatorType = typename SimpleVector<Element, Alloc>::AllocatorType;
+    using ConstIterator = const Element*;
+
+    //   
+    size_t GetSize() const noexcept {
+        return items_.GetSize();
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return items_.IsEmpty();
+    }
+
+    //    new_capacity 
+    void Reserve(size_t new_capacity) {
+        items_.Reserve(new_capacity);
+    }
+
+    //     
+    void ShrinkToFit() {
+        items_.ShrinkToFit();
+    }
+
+    //   ,   
+    void Clear() noexcept {
+        items_.Clear();
+    }
+
+    ConstIterator begin() const noexcept {
+        return items_.begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return items_.end();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return items_.cbegin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return items_.cend();
+    }
+
+    //   ,     key
+    ConstIterator LowerBound(const Key& key) const {
+        return BranchlessLowerBound(items_.begin(), items_.GetSize(), key,
+            [this](const Element& element, const Key& value) { return comp_(KeyOf()(element), value); });
+    }
+
+    //   ,    key
+    ConstIterator UpperBound(const Key& key) const {
+        return BranchlessLowerBound(items_.begin(), items_.GetSize(), key,
+            [this](const Element& element, const Key& value) { return !comp_(value, KeyOf()(element)); });
+    }
+
+    //     key  end()
+    ConstIterator Find(const Key& key) const {
+        const ConstIterator it = LowerBound(key);
+        return it != end() && !comp_(key, KeyOf()(*it)) ? it : end();
+    }
+
+    bool Contains(const Key& key) const {
+        return Find(key) != end();
+    }
+
+    size_t Count(const Key& key) const {
+        return Contains(key) ? 1 : 0;
+    }
+
+    //     key,    (0  1)
+    size_t Erase(const Key& key) {
+        const ConstIterator it = Find(key);
+        if (it == end())
+            return 0;
+        items_.Erase(it);
+        return 1;
+    }
+
+    //   ,   pred  true,   .  
+    template <typename Predicate>
+    size_t EraseIf(Predicate pred) {
+        return items_.EraseIf(pred);
+    }
+
+    //    [first, last):      , 
+    //       O((n + m) log m)  m    .
+    //        
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    void InsertRange(InputIt first, InputIt last) {
+        const size_t sorted = items_.GetSize();
+        items_.Append(first, last);
+        SortAndUnique(sorted);
+    }
+
+    //    ,   
+    SimpleVector<Element, Alloc> Extract() noexcept {
+        return std::move(items_);
+    }
+
+protected:
+    FlatSortedBase() = default;
+
+    //  items   ,   
+    explicit FlatSortedBase(SimpleVector<Element, Alloc>&& items)
+        :items_(std::move(items))
+    {
+        SortAndUnique(0);
+    }
+
+    FlatSortedBase(SortedUniqueTag, SimpleVector<Element, Alloc>&& items)
+        :items_(std::move(items))
+    {
+        assert(std::adjacent_find(items_.begin(), items_.end(),
+            [this](const Element& lhs, const Element& rhs) { return !comp_(KeyOf()(lhs), KeyOf()(rhs)); }) == items_.end());
+    }
+
+    Element* MutableIterator(ConstIterator it) noexcept {
+        return items_.begin() + (it - items_.cbegin());
+    }
+
+    //    args    key,     .
+    //     key   ,    
+    template <typename... Args>
+    std::pair<Element*, bool> EmplaceUnique(const Key& key, Args&&... args) {
+        const ConstIterator it = LowerBound(key);
+        if (it != end() && !comp_(key, KeyOf()(*it)))
+            return { MutableIterator(it), false };
+        return { items_.Emplace(it, std::forward<Args>(args)...), true };
+    }
+
+    SimpleVector<Element, Alloc> items_;
+    Compare comp_;
+
+private:
+    //  ,   sorted,         .
+    //    ,     
+    void SortAndUnique(size_t sorted) {
+        const auto less = [this](const Element& lhs, const Element& rhs) {
+            return comp_(KeyOf()(lhs), KeyOf()(rhs));
+        };
+        std::stable_sort(items_.begin() + sorted, items_.end(), less);
+        std::inplace_merge(items_.begin(), items_.begin() + sorted, items_.end(), less);
+        const auto new_end = std::unique(items_.begin(), items_.end(),
+            [&less](const Element& lhs, const Element& rhs) { return !less(lhs, rhs); });
+        items_.Erase(new_end, items_.cend());
+    }
+};
+
+//        SimpleVector
+template <typename Key, typename Compare = std::less<Key>, typename Alloc = std::allocator<Key>>
+class FlatSet : public FlatSortedBase<Key, Key, FlatIdentityKey, Compare, Alloc> {
+    using Base = FlatSortedBase<Key, Key, FlatIdentityKey, Compare, Alloc>;
+
+public:
+    using typename Base::ConstIterator;
+    using Iterator = ConstIterator;
+
+    FlatSet() = default;
+
+    //    [first, last)       
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    FlatSet(InputIt first, InputIt last)
+        :Base(SimpleVector<Key, Alloc>(first, last))
+    {
+    }
+
+    FlatSet(std::initializer_list<Key> init)
+        :FlatSet(init.begin(), init.end())
+    {
+    }
+
+    //    items   ,  
+    explicit FlatSet(SimpleVector<Key, Alloc> items)
+        :Base(std::move(items))
+    {
+    }
+
+    //      ,   
+    FlatSet(SortedUniqueTag tag, SimpleVector<Key, Alloc> items)
+        :Base(tag, std::move(items))
+    {
+    }
+
+    //  key,    .       
+    std::pair<Iterator, bool> Insert(const Key& key) {
+        return this->EmplaceUnique(key, key);
+    }
+
+    std::pair<Iterator, bool> Insert(Key&& key) {
+        return this->EmplaceUnique(key, std::move(key));
+    }
+
+    using Base::Erase;
+
+    //   pos     
+    Iterator Erase(ConstIterator pos) {
+        return this->items_.Erase(pos);
+    }
+};
+
+template <typename Key, typename Compare, typename Alloc>
+bool operator==(const FlatSet<Key, Compare, Alloc>& lhs, const FlatSet<Key, Compare, Alloc>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && EqualElements(lhs.begin(), rhs.begin(), lhs.GetSize());
+}
+
+template <typename Key, typename Compare, typename Alloc>
+bool operator!=(const FlatSet<Key, Compare, Alloc>& lhs, const FlatSet<Key, Compare, Alloc>& rhs) {
+    return !(lhs == rhs);
+}
+
+//      SimpleVector   (, ).
+//     ,   :    
+template <typename Key, typename Value, typename Compare = std::less<Key>,
+    typename Alloc = std::allocator<std::pair<Key, Value>>>
+class FlatMap : public FlatSortedBase<std::pair<Key, Value>, Key, FlatFirstKey, Compare, Alloc> {
+    using Base = FlatSortedBase<std::pair<Key, Value>, Key, FlatFirstKey, Compare, Alloc>;
+
+public:
+    using ElementType = std::pair<Key, Value>;
+    using Iterator = ElementType*;
+    using typename Base::ConstIterator;
+
+    FlatMap() = default;
+
+    //    [first, last)       .
+    //       
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    FlatMap(InputIt first, InputIt last)
+        :Base(SimpleVector<ElementType, Alloc>(first, last))
+    {
+    }
+
+    FlatMap(std::initializer_list<ElementType> init)
+        :FlatMap(init.begin(), init.end())
+    {
+    }
+
+    //    items     ,  
+    explicit FlatMap(SimpleVector<ElementType, Alloc> items)
+        :Base(std::move(items))
+    {
+    }
+
+    //       ,   
+    FlatMap(SortedUniqueTag tag, SimpleVector<ElementType, Alloc> items)
+        :Base(tag, std::move(items))
+    {
+    }
+
+    using Base::begin;
+    using Base::end;
+    using Base::Find;
+
+    Iterator begin() noexcept {
+        return this->items_.begin();
+    }
+
+    Iterator end() noexcept {
+        return this->items_.end();
+    }
+
+    Iterator Find(const Key& key) {
+        return this->MutableIterator(std::as_const(*this).Find(key));
+    }
+
+    //     key,       
+    Value& operator[](const Key& key) {
+        return TryEmplace(key).first->second;
+    }
+
+    //     key.
+    //   std::out_of_range,   
+    Value& At(const Key& key) {
+        const Iterator it = Find(key);
+        if (it == end())
+            throw std::out_of_range("Key not found");
+        return it->second;
+    }
+
+    const Value& At(const Key& key) const {
+        const ConstIterator it = Find(key);
+        if (it == end())
+            throw std::out_of_range("Key not found");
+        return it->second;
+    }
+
+    //  ,    .          
+    std::pair<Iterator, bool> Insert(const ElementType& element) {
+        return this->EmplaceUnique(element.first, element);
+    }
+
+    std::pair<Iterator, bool> Insert(ElementType&& element) {
+        return this->EmplaceUnique(element.first, std::move(element));
+    }
+
+    //    args,    key  
+    template <typename... Args>
+    std::pair<Iterator, bool> TryEmplace(const Key& key, Args&&... args) {
+        return this->EmplaceUnique(key, std::piecewise_construct,
+            std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    //     value  
+    template <typename V>
+    std::pair<Iterator, bool> InsertOrAssign(const Key& key, V&& value) {
+        auto result = TryEmplace(key, std::forward<V>(value));
+        if (!result.second)
+            result.first->second = std::forward<V>(value);
+        return result;
+    }
+
+    using Base::Erase;
+
+    //   pos     
+    Iterator Erase(ConstIterator pos) {
+        return this->items_.Erase(pos);
+    }
+};
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+bool operator==(const FlatMap<Key, Value, Compare, Alloc>& lhs, const FlatMap<Key, Value, Compare, Alloc>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && EqualElements(lhs.begin(), rhs.begin(), lhs.GetSize());
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+bool operator!=(const FlatMap<Key, Value, Compare, Alloc>& lhs, const FlatMap<Key, Value, Compare, Alloc>& rhs) {
+    return !(lhs == rhs);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+//    SimpleVector.
+// NextCapacity   ,    required
+//     ,       required
+
+//  ,       1
+struct GrowthDouble {
+    static constexpr size_t NextCapacity(size_t capacity, size_t required, size_t) noexcept {
+        return std::max(capacity == 0u ? 1 : capacity * 2, required);
+    }
+};
+
+//    :    ,   
+//       
+struct GrowthOneAndHalf {
+    static constexpr size_t NextCapacity(size_t capacity, size_t required, size_t) noexcept {
+        return std::max(capacity + capacity / 2 + 1, required);
+    }
+};
+
+//           :
+//       ,       PageSize.
+//     ,    ,    ,
+//    ,    ,       ,
+//       
+template <size_t PageSize = 4096>
+struct GrowthPageRounded {
+    static_assert(PageSize > 0 && (PageSize & (PageSize - 1)) == 0, "Page size must be a power of two");
+
+    static constexpr size_t NextCapacity(size_t capacity, size_t required, size_t element_size) noexcept {
+        const size_t wanted = std::max(capacity + capacity / 2 + 1, required);
+        size_t bytes = wanted * element_size;
+        if (bytes < PageSize) {
+            size_t size_class = 1;
+            while (size_class < bytes) {
+                size_class *= 2;
+            }
+            bytes = std::min(size_class, PageSize);
+        }
+        else {
+            bytes = (bytes + PageSize - 1) & ~(PageSize - 1);
+        }
+        return std::max(bytes / element_size, required);
+    }
+};
\ No newline at end of file
@@ -0,0 +1,252 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <system_error>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//   HugePageAllocator    
+enum class HugePages {
+    //  
+    kNone,
+    //    (madvise MADV_HUGEPAGE);    kHugePageSize
+    kTransparent,
+    //    hugetlbfs (MAP_HUGETLB);      ,  kTransparent
+    kExplicit,
+};
+
+//      NUMA (. mbind(2))
+enum class NumaPolicy {
+    //     ,    
+    kDefault,
+    //       nodes
+    kPreferred,
+    //     nodes
+    kBind,
+    //      nodes
+    kInterleave,
+};
+
+//       HugePageAllocator.  i  nodes   NUMA   i
+struct MemoryPlacement {
+    HugePages huge_pages = HugePages::kTransparent;
+    NumaPolicy numa = NumaPolicy::kDefault;
+    unsigned long nodes = 0;
+};
+
+inline bool operator==(const MemoryPlacement& lhs, const MemoryPlacement& rhs) noexcept {
+    return lhs.huge_pages == rhs.huge_pages && lhs.numa == rhs.numa && lhs.nodes == rhs.nodes;
+}
+
+inline bool operator!=(const MemoryPlacement& lhs, const MemoryPlacement& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+//    x86-64  AArch64     4 
+inline constexpr size_t kHugePageSize = size_t(2) << 20;
+
+// ,      placement:    
+inline size_t PlacementPageSize(const MemoryPlacement& placement) noexcept {
+    if (placement.huge_pages != HugePages::kNone)
+        return kHugePageSize;
+    return static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+}
+
+//      [ptr, ptr + bytes)  NUMA  placement.
+//    NUMA (ENOSYS)  ,    .
+//   mbind   std::system_error
+inline void ApplyNumaPolicy(void* ptr, size_t bytes, const MemoryPlacement& placement) {
+    //  MPOL_*  <linux/mempolicy.h>
+    constexpr int kMpolPreferred = 1;
+    constexpr int kMpolBind = 2;
+    constexpr int kMpolInterleave = 3;
+
+    int mode = 0;
+    switch (placement.numa) {
+    case NumaPolicy::kDefault:
+        return;
+    case NumaPolicy::kPreferred:
+        mode = kMpolPreferred;
+        break;
+    case NumaPolicy::kBind:
+        mode = kMpolBind;
+        break;
+    case NumaPolicy::kInterleave:
+        mode = kMpolInterleave;
+        break;
+    }
+    const unsigned long nodes = placement.nodes;
+    if (::syscall(SYS_mbind, ptr, bytes, mode, &nodes, sizeof(nodes) * 8, 0) != 0 && errno != ENOSYS)
+        throw std::system_error(errno, std::system_category(), "mbind");
+}
+
+//  bytes     placement; bytes  PlacementPageSize(placement).
+//     std::bad_alloc
+inline void* MapPages(size_t bytes, const MemoryPlacement& placement) {
+    const int protection = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    void* ptr = MAP_FAILED;
+    if (placement.huge_pages == HugePages::kExplicit)
+        ptr = ::mmap(nullptr, bytes, protection, flags | MAP_HUGETLB, -1, 0);
+
+    if (ptr == MAP_FAILED) {
+        //         kHugePageSize ,
+        //       ,     
+        const bool huge = placement.huge_pages != HugePages::kNone;
+        const size_t mapped = huge ? bytes + kHugePageSize : bytes;
+        char* raw = static_cast<char*>(::mmap(nullptr, mapped, protection, flags, -1, 0));
+        if (raw == MAP_FAILED)
+            throw std::bad_alloc();
+        char* aligned = raw;
+        if (huge) {
+            aligned = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(raw) + kHugePageSize - 1) & ~(kHugePageSize - 1));
+            if (aligned != raw)
+                ::munmap(raw, aligned - raw);
+            if (aligned + bytes != raw + mapped)
+                ::munmap(aligned + bytes, raw + mapped - aligned - bytes);
+            //       ,    
+            ::madvise(aligned, bytes, MADV_HUGEPAGE);
+        }
+        ptr = aligned;
+    }
+
+    try {
+        ApplyNumaPolicy(ptr, bytes, placement);
+    }
+    catch (...) {
+        ::munmap(ptr, bytes);
+        throw;
+    }
+    return ptr;
+}
+
+// ,      mmap:    (  TLB)
+//     NUMA.     (kHugePageSize  ),
+//      ,     .
+//  reallocate: SimpleVector      mremap  ,  .
+//          placement
+template <typename Type>
+class HugePageAllocator {
+public:
+    using value_type = Type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    HugePageAllocator() noexcept = default;
+
+    explicit HugePageAllocator(const MemoryPlacement& placement) noexcept
+        :placement_(placement)
+    {
+    }
+
+    template <typename Other>
+    HugePageAllocator(const HugePageAllocator<Other>& other) noexcept
+        :placement_(other.GetPlacement())
+    {
+    }
+
+    const MemoryPlacement& GetPlacement() const noexcept {
+        return placement_;
+    }
+
+    Type* allocate(size_t n) {
+        if (n > (static_cast<size_t>(-1) - kHugePageSize) / sizeof(Type))
+            throw std::bad_array_new_length();
+        return static_cast<Type*>(MapPages(MappedBytes(n), placement_));
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept {
+        ::munmap(ptr, MappedBytes(n));
+    }
+
+    //    ptr  old_n  new_n ,   .
+    //       (    ),
+    //         
+    Type* reallocate(Type* ptr, size_t old_n, size_t new_n) {
+        const size_t old_bytes = MappedBytes(old_n);
+        const size_t new_bytes = MappedBytes(new_n);
+        char* bytes = reinterpret_cast<char*>(ptr);
+        if (new_bytes == old_bytes)
+            return ptr;
+        if (new_bytes < old_bytes) {
+            ::munmap(bytes + new_bytes, old_bytes - new_bytes);
+            return ptr;
+        }
+        if (::mremap(ptr, old_bytes, new_bytes, 0) != MAP_FAILED) {
+            if (placement_.huge_pages != HugePages::kNone)
+                ::madvise(bytes + old_bytes, new_bytes - old_bytes, MADV_HUGEPAGE);
+            try {
+                ApplyNumaPolicy(bytes + old_bytes, new_bytes - old_bytes, placement_);
+            }
+            catch (...) {
+                ::munmap(bytes + old_bytes, new_bytes - old_bytes);
+                throw;
+            }
+            return ptr;
+        }
+        Type* fresh = allocate(new_n);
+        std::memcpy(static_cast<void*>(fresh), static_cast<const void*>(ptr), old_n * sizeof(Type));
+        deallocate(ptr, old_n);
+        return fresh;
+    }
+
+    template <typename Other>
+    bool operator==(const HugePageAllocator<Other>& other) const noexcept {
+        return placement_ == other.GetPlacement();
+    }
+
+    template <typename Other>
+    bool operator!=(const HugePageAllocator<Other>& other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    size_t MappedBytes(size_t n) const noexcept {
+        const size_t page = PlacementPageSize(placement_);
+        return (n * sizeof(Type) + page - 1) / page * page;
+    }
+
+    MemoryPlacement placement_;
+};
+
+//  HugePageAllocator ,  SimpleVector(size, value, Parallel, alloc)
+//     ,       ,   
+template <typename Type>
+struct IsParallelSafeAllocator<HugePageAllocator<Type>> : std::true_type {
+};
+
+//  :  policy        
+//  count    data,      ,  ParallelForChunks  count .
+//    PlacementPageSize(placement):        
+//  kHugePageSize ,            .
+//  NumaPolicy::kDefault     ,     .
+//    ,    Reserve,  placement  
+template <typename Type>
+void ParallelFirstTouch(Type* data, size_t count, const Parallel& policy, const MemoryPlacement& placement) {
+    const size_t page = PlacementPageSize(placement);
+    char* const base = reinterpret_cast<char*>(data);
+    ParallelForChunks(ParallelChunkCount(policy, count), count, [=](size_t, size_t first, size_t last) {
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(base + first * sizeof(Type));
+        const uintptr_t end = reinterpret_cast<uintptr_t>(base + last * sizeof(Type));
+        //       :   , 
+        //  ,       .
+        // ,     ,   
+        if (first == 0 && begin < end)
+            *reinterpret_cast<volatile char*>(begin) = 0;
+        for (uintptr_t byte = (begin + page - 1) & ~(page - 1); byte < end; byte += page) {
+            *reinterpret_cast<volatile char*>(byte) = 0;
+        }
+    });
+}
+
+#endif
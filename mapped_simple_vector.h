@@ -0,0 +1,298 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+//    ,   ,    (mmap).
+//         :    
+//  ,    ,    .
+//    ftruncate   ,     .
+//  :  FileHeader  kHeaderSize ,  .
+//     std::system_error,    std::runtime_error
+template <typename Type>
+class MappedSimpleVector {
+    static_assert(std::is_trivially_copyable_v<Type>, "Only trivially copyable types can live in a mapped file");
+
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    //  ;     
+    static constexpr size_t kHeaderSize = 64;
+    static_assert(alignof(Type) <= kHeaderSize, "Element alignment exceeds the file header size");
+
+    //   path,   ,   
+    explicit MappedSimpleVector(const std::string& path) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0)
+            ThrowSystemError("open");
+        try {
+            struct stat info {};
+            if (::fstat(fd_, &info) != 0)
+                ThrowSystemError("fstat");
+            if (info.st_size == 0) {
+                Remap(kInitialCapacity);
+                *Header() = FileHeader{};
+                Header()->capacity = kInitialCapacity;
+            }
+            else {
+                if (static_cast<size_t>(info.st_size) < kHeaderSize)
+                    throw std::runtime_error("Mapped vector file is truncated");
+                MapExisting(static_cast<size_t>(info.st_size));
+            }
+        }
+        catch (...) {
+            Unmap();
+            ::close(fd_);
+            throw;
+        }
+    }
+
+    MappedSimpleVector(const MappedSimpleVector&) = delete;
+    MappedSimpleVector& operator=(const MappedSimpleVector&) = delete;
+
+    MappedSimpleVector(MappedSimpleVector&& other) noexcept
+        :fd_(std::exchange(other.fd_, -1)), mapping_(std::exchange(other.mapping_, nullptr)),
+        mapping_size_(std::exchange(other.mapping_size_, 0))
+    {
+    }
+
+    MappedSimpleVector& operator=(MappedSimpleVector&& other) noexcept {
+        if (this == &other)
+            return *this;
+        Close();
+        fd_ = std::exchange(other.fd_, -1);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mapping_size_ = std::exchange(other.mapping_size_, 0);
+        return *this;
+    }
+
+    //    :         Flush
+    ~MappedSimpleVector() {
+        Close();
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return mapping_ ? Header()->size : 0;
+    }
+
+    //   ,   
+    size_t GetCapacity() const noexcept {
+        return mapping_ ? Header()->capacity : 0;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //       index
+    Type& operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        return Data()[index];
+    }
+
+    //        index
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return Data()[index];
+    }
+
+    //       index.
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= GetSize())
+            throw std::out_of_range("Index out of range");
+        return Data()[index];
+    }
+
+    //        index.
+    //   std::out_of_range,  index >= size
+    const Type& At(size_t index) const {
+        if (index >= GetSize())
+            throw std::out_of_range("Index out of range");
+        return Data()[index];
+    }
+
+    //   ,   
+    void Clear() noexcept {
+        if (mapping_)
+            Header()->size = 0;
+    }
+
+    //   .      
+    void Resize(size_t new_size) {
+        const size_t size = GetSize();
+        if (new_size > GetCapacity())
+            Reserve(std::max(GetCapacity() * 2, new_size));
+        for (size_t i = size; i < new_size; ++i) {
+            new (static_cast<void*>(Data() + i)) Type();
+        }
+        Header()->size = new_size;
+    }
+
+    //   ,     new_capacity 
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= GetCapacity())
+            return;
+        //      ,   
+        // ,    -   
+        Remap(new_capacity);
+        Header()->capacity = new_capacity;
+    }
+
+    void PushBack(const Type& value) {
+        const size_t size = GetSize();
+        if (size == GetCapacity()) {
+            // value     ,     
+            const Type copy = value;
+            Reserve(std::max<size_t>(GetCapacity() * 2, 1));
+            new (static_cast<void*>(Data() + size)) Type(copy);
+        }
+        else {
+            new (static_cast<void*>(Data() + size)) Type(value);
+        }
+        Header()->size = size + 1;
+    }
+
+    // ""   .    SimpleVector,      ,
+    //          
+    void PopBack() noexcept {
+        if (IsEmpty())
+            return;
+        --Header()->size;
+    }
+
+    //     
+    void Flush() {
+        if (mapping_ && ::msync(mapping_, mapping_size_, MS_SYNC) != 0)
+            ThrowSystemError("msync");
+    }
+
+    Iterator begin() noexcept {
+        return Data();
+    }
+
+    Iterator end() noexcept {
+        return Data() + GetSize();
+    }
+
+    ConstIterator begin() const noexcept {
+        return Data();
+    }
+
+    ConstIterator end() const noexcept {
+        return Data() + GetSize();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    //    ,    
+    static constexpr uint64_t kMagic = 0x31564D53u; // "SMV1"
+    static constexpr size_t kInitialCapacity = (4096 - kHeaderSize) / sizeof(Type) > 0
+        ? (4096 - kHeaderSize) / sizeof(Type) : 1;
+
+    struct FileHeader {
+        uint64_t magic = kMagic;
+        uint64_t element_size = sizeof(Type);
+        uint64_t size = 0;
+        uint64_t capacity = 0;
+    };
+    static_assert(sizeof(FileHeader) <= kHeaderSize);
+
+    [[noreturn]] static void ThrowSystemError(const char* what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    static size_t FileSize(size_t capacity) noexcept {
+        return kHeaderSize + capacity * sizeof(Type);
+    }
+
+    FileHeader* Header() const noexcept {
+        return static_cast<FileHeader*>(mapping_);
+    }
+
+    Type* Data() const noexcept {
+        return mapping_ ? reinterpret_cast<Type*>(static_cast<char*>(mapping_) + kHeaderSize) : nullptr;
+    }
+
+    void MapExisting(size_t file_size) {
+        void* mapping = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED)
+            ThrowSystemError("mmap");
+        mapping_ = mapping;
+        mapping_size_ = file_size;
+        const FileHeader& header = *Header();
+        if (header.magic != kMagic || header.element_size != sizeof(Type))
+            throw std::runtime_error("File does not hold a mapped vector of this element type");
+        if (header.size > header.capacity || FileSize(header.capacity) > file_size)
+            throw std::runtime_error("Mapped vector file is truncated");
+    }
+
+    //    capacity     .
+    //    ,     
+    void Remap(size_t capacity) {
+        const size_t file_size = FileSize(capacity);
+        const size_t old_file_size = mapping_size_;
+        if (::ftruncate(fd_, static_cast<off_t>(file_size)) != 0)
+            ThrowSystemError("ftruncate");
+#if defined(__linux__)
+        void* mapping = mapping_
+            ? ::mremap(mapping_, mapping_size_, file_size, MREMAP_MAYMOVE)
+            : ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED)
+            RollBackAndThrow(old_file_size, "mremap");
+#else
+        void* mapping = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED)
+            RollBackAndThrow(old_file_size, "mmap");
+        Unmap();
+#endif
+        mapping_ = mapping;
+        mapping_size_ = file_size;
+    }
+
+    [[noreturn]] void RollBackAndThrow(size_t old_file_size, const char* what) {
+        const int error = errno;
+        //     :     
+        [[maybe_unused]] const int result = ::ftruncate(fd_, static_cast<off_t>(old_file_size));
+        errno = error;
+        ThrowSystemError(what);
+    }
+
+    void Unmap() noexcept {
+        if (mapping_)
+            ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+    }
+
+    void Close() noexcept {
+        Unmap();
+        if (fd_ >= 0)
+            ::close(fd_);
+        fd_ = -1;
+    }
+
+    int fd_ = -1;
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+};
+
+#endif
\ No newline at end of file
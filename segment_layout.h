@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+#if __has_include(<bit>)
+#include <bit>
+#endif
+
+//     value, value > 0
+constexpr size_t FloorLog2(size_t value) noexcept {
+#if defined(__cpp_lib_bitops)
+    return static_cast<size_t>(std::bit_width(value)) - 1;
+#elif defined(__GNUC__)
+    return std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(value);
+#else
+    size_t result = 0;
+    while (value >>= 1) {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+//      :  k  FirstSegment << k 
+//     FirstSegment * (2^k - 1).      ,
+//     ,    size_t,      
+template <size_t FirstSegment>
+struct GeometricSegments {
+    static_assert(FirstSegment > 0 && (FirstSegment & (FirstSegment - 1)) == 0,
+        "First segment size must be a power of two");
+
+    static constexpr size_t kMaxSegments = std::numeric_limits<size_t>::digits - FloorLog2(FirstSegment);
+
+    struct Position {
+        size_t segment;
+        size_t offset;
+    };
+
+    //   segment
+    static constexpr size_t Capacity(size_t segment) noexcept {
+        return FirstSegment << segment;
+    }
+
+    //     segment
+    static constexpr size_t Start(size_t segment) noexcept {
+        return FirstSegment * ((size_t(1) << segment) - 1);
+    }
+
+    //         index
+    static constexpr Position Locate(size_t index) noexcept {
+        const size_t segment = FloorLog2(index / FirstSegment + 1);
+        return { segment, index - Start(segment) };
+    }
+};
\ No newline at end of file
@@ -0,0 +1,444 @@
+#pragma once
+
+#include "simple_vector.h"
+#include "segment_layout.h"
+
+// ,           .
+//  k  FirstSegment << k  (. segment_layout.h),    O(1),
+// PushBack           ,
+//         
+template <typename Type, size_t FirstSegment = 64, typename Alloc = std::allocator<Type>>
+class SegmentedSimpleVector : private AllocatorHolder<typename std::allocator_traits<Alloc>::template rebind_alloc<Type>> {
+    using AllocTraits = typename std::allocator_traits<Alloc>::template rebind_traits<Type>;
+    using Segments = GeometricSegments<FirstSegment>;
+
+    template <bool Const>
+    class BasicIterator;
+
+public:
+    using AllocatorType = typename AllocTraits::allocator_type;
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    SegmentedSimpleVector() noexcept(noexcept(AllocatorType())) = default;
+
+    //   ,      alloc
+    explicit SegmentedSimpleVector(const AllocatorType& alloc) noexcept
+        :Holder(alloc)
+    {
+    }
+
+    //    size ,    
+    explicit SegmentedSimpleVector(size_t size, const AllocatorType& alloc = AllocatorType())
+        :Holder(alloc)
+    {
+        Resize(size);
+    }
+
+    //    size ,   value
+    SegmentedSimpleVector(size_t size, const Type& value, const AllocatorType& alloc = AllocatorType())
+        :Holder(alloc)
+    {
+        Reserve(size);
+        try {
+            for (size_t i = 0; i < size; ++i) {
+                EmplaceBack(value);
+            }
+        }
+        catch (...) {
+            Clear();
+            throw;
+        }
+    }
+
+    //    std::initializer_list
+    SegmentedSimpleVector(std::initializer_list<Type> init, const AllocatorType& alloc = AllocatorType())
+        :Holder(alloc)
+    {
+        AppendCopies(init.begin(), init.end(), init.size());
+    }
+
+    SegmentedSimpleVector(const SegmentedSimpleVector& other)
+        :Holder(AllocTraits::select_on_container_copy_construction(other.GetAlloc()))
+    {
+        AppendCopies(other.begin(), other.end(), other.size_);
+    }
+
+    SegmentedSimpleVector(SegmentedSimpleVector&& other) noexcept
+        :Holder(other.GetAlloc()), size_(std::exchange(other.size_, 0)), segments_(std::move(other.segments_))
+    {
+    }
+
+    SegmentedSimpleVector& operator=(const SegmentedSimpleVector& rhs) {
+        if (this == &rhs)
+            return *this;
+        SegmentedSimpleVector temp(rhs);
+        swap(temp);
+        return *this;
+    }
+
+    SegmentedSimpleVector& operator=(SegmentedSimpleVector&& other) noexcept {
+        if (this == &other)
+            return *this;
+        SegmentedSimpleVector temp(std::move(other));
+        swap(temp);
+        return *this;
+    }
+
+    ~SegmentedSimpleVector() {
+        Clear();
+    }
+
+    //   ,     
+    AllocatorType GetAllocator() const noexcept {
+        return GetAlloc();
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    //     
+    size_t GetCapacity() const noexcept {
+        return Segments::Start(segments_.GetSize());
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    //    
+    size_t GetSegmentCount() const noexcept {
+        return segments_.GetSize();
+    }
+
+    Type& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return *Slot(index);
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return *Slot(index);
+    }
+
+    //       index.
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= size_)
+            throw std::out_of_range("Index out of range");
+        return *Slot(index);
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= size_)
+            throw std::out_of_range("Index out of range");
+        return *Slot(index);
+    }
+
+    //  ,      
+    void Clear() noexcept {
+        while (size_ > 0) {
+            PopBack();
+        }
+    }
+
+    //   .
+    //         
+    void Resize(size_t new_size) {
+        while (size_ > new_size) {
+            PopBack();
+        }
+        Reserve(new_size);
+        while (size_ < new_size) {
+            EmplaceBack();
+        }
+    }
+
+    //     new_capacity 
+    void Reserve(size_t new_capacity) {
+        while (GetCapacity() < new_capacity) {
+            AddSegment();
+        }
+    }
+
+    //  ,     
+    void ShrinkToFit() {
+        const size_t needed = size_ == 0 ? 0 : Segments::Locate(size_ - 1).segment + 1;
+        while (segments_.GetSize() > needed) {
+            segments_.PopBack();
+        }
+    }
+
+    void PushBack(const Type& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(Type&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    //    args   .    
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        if (size_ == GetCapacity())
+            AddSegment();
+        Type* slot = Slot(size_);
+        AllocTraits::construct(GetAlloc(), slot, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    // ""   .     
+    void PopBack() noexcept {
+        if (size_ == 0u)
+            return;
+        --size_;
+        AllocTraits::destroy(GetAlloc(), Slot(size_));
+    }
+
+    //   value   pos,      .
+    //     
+    Iterator Insert(ConstIterator pos, Type value) {
+        const size_t index = pos.index_;
+        assert(index <= size_);
+        EmplaceBack(std::move(value));
+        std::rotate(begin() + index, end() - 1, end());
+        return begin() + index;
+    }
+
+    //      
+    Iterator Erase(ConstIterator pos) {
+        const size_t index = pos.index_;
+        assert(index < size_);
+        std::move(begin() + index + 1, end(), begin() + index);
+        PopBack();
+        return begin() + index;
+    }
+
+    //     
+    void swap(SegmentedSimpleVector& other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            std::swap(GetAlloc(), other.GetAlloc());
+        }
+        else {
+            assert(GetAlloc() == other.GetAlloc());
+        }
+        std::swap(size_, other.size_);
+        segments_.swap(other.segments_);
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, size_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    using Holder = AllocatorHolder<AllocatorType>;
+    using Holder::GetAlloc;
+
+    //   :    ,     
+    template <bool Const>
+    class BasicIterator {
+        using Owner = std::conditional_t<Const, const SegmentedSimpleVector, SegmentedSimpleVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const Type*, Type*>;
+        using reference = std::conditional_t<Const, const Type&, Type&>;
+
+        BasicIterator() noexcept = default;
+
+        BasicIterator(Owner* owner, size_t index) noexcept
+            :owner_(owner), index_(index)
+        {
+        }
+
+        //     
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            :owner_(other.owner_), index_(other.index_)
+        {
+        }
+
+        reference operator*() const noexcept {
+            return *owner_->Slot(index_);
+        }
+
+        pointer operator->() const noexcept {
+            return owner_->Slot(index_);
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return *owner_->Slot(index_ + offset);
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator<=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ <= rhs.index_;
+        }
+
+        friend bool operator>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ > rhs.index_;
+        }
+
+        friend bool operator>=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ >= rhs.index_;
+        }
+
+    private:
+        friend class SegmentedSimpleVector;
+        template <bool>
+        friend class BasicIterator;
+
+        Owner* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    Type* Slot(size_t index) const noexcept {
+        const auto position = Segments::Locate(index);
+        return segments_[position.segment].Get() + position.offset;
+    }
+
+    //   ;       size_t
+    void AddSegment() {
+        const size_t segment = segments_.GetSize();
+        if (segment == Segments::kMaxSegments)
+            throw std::length_error("Segmented vector is too large");
+        if (segments_.GetCapacity() == 0)
+            segments_.Reserve(Segments::kMaxSegments);
+        segments_.EmplaceBack(Segments::Capacity(segment), GetAlloc());
+    }
+
+    //  count  [first, last)   ;    
+    template <typename InputIt>
+    void AppendCopies(InputIt first, InputIt last, size_t count) {
+        Reserve(size_ + count);
+        try {
+            for (; first != last; ++first) {
+                EmplaceBack(*first);
+            }
+        }
+        catch (...) {
+            Clear();
+            throw;
+        }
+    }
+
+    size_t size_ = 0;
+    SimpleVector<ArrayPtr<Type, AllocatorType>> segments_;
+};
+
+template <typename Type, size_t FirstSegment, typename Alloc>
+inline bool operator==(const SegmentedSimpleVector<Type, FirstSegment, Alloc>& lhs, const SegmentedSimpleVector<Type, FirstSegment, Alloc>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize())
+        return false;
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, size_t FirstSegment, typename Alloc>
+inline bool operator!=(const SegmentedSimpleVector<Type, FirstSegment, Alloc>& lhs, const SegmentedSimpleVector<Type, FirstSegment, Alloc>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t FirstSegment, typename Alloc>
+inline bool operator<(const SegmentedSimpleVector<Type, FirstSegment, Alloc>& lhs, const SegmentedSimpleVector<Type, FirstSegment, Alloc>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t FirstSegment, typename Alloc>
+inline bool operator<=(const SegmentedSimpleVector<Type, FirstSegment, Alloc>& lhs, const SegmentedSimpleVector<Type, FirstSegment, Alloc>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t FirstSegment, typename Alloc>
+inline bool operator>(const SegmentedSimpleVector<Type, FirstSegment, Alloc>& lhs, const SegmentedSimpleVector<Type, FirstSegment, Alloc>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t FirstSegment, typename Alloc>
+inline bool operator>=(const SegmentedSimpleVector<Type, FirstSegment, Alloc>& lhs, const SegmentedSimpleVector<Type, FirstSegment, Alloc>& rhs) {
+    return !(lhs < rhs);
+}
\ No newline at end of file
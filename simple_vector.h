@@ -6,20 +6,32 @@
 #include <stdexcept>
 #include <utility>
 #include <iterator>
+#include <memory>
+#include <new>
+#include <cstring>
+#include <type_traits>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
 
-#include "array_ptr.h"
+#if defined(__cpp_impl_three_way_comparison)
+#include <compare>
+#endif
 
-template< class ForwardIt, class Type >
-void FillByMove(ForwardIt first, ForwardIt last, Type&&)
-{
-    for (; first != last; ++first) {
-        *first = std::move(Type());
-    }
-}
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "array_ptr.h"
+#include "constexpr_support.h"
+#include "growth_policy.h"
+#include "simple_vector_stats.h"
+#include "simple_vector_parallel.h"
 
 class ReserveProxyObj {
 public:
-    ReserveProxyObj(size_t capacity_to_reserve)
+    SIMPLE_VECTOR_CONSTEXPR ReserveProxyObj(size_t capacity_to_reserve)
         :size_(capacity_to_reserve)
     {
     }
@@ -27,76 +39,427 @@ public:
     size_t size_ = 0;
 };
 
-ReserveProxyObj Reserve(size_t capacity_to_reserve) {
+inline SIMPLE_VECTOR_CONSTEXPR ReserveProxyObj Reserve(size_t capacity_to_reserve) {
     return ReserveProxyObj(capacity_to_reserve);
 }
 
+//   ,         
+//   .    Reserve, Insert  Erase   memcpy/memmove.
+//     ,    , :
+// template <> struct IsTriviallyRelocatable<MyType> : std::true_type {};
+template <typename Type>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<Type> {
+};
+
 template <typename Type>
-class SimpleVector {
+inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<Type>::value;
+
+//     ,  SimpleVector(size, value)     
+template <typename It>
+using RequireInputIterator = std::enable_if_t<
+    std::is_convertible_v<typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>;
+
+template <typename It>
+inline constexpr bool IsForwardIteratorV =
+    std::is_convertible_v<typename std::iterator_traits<It>::iterator_category, std::forward_iterator_tag>;
+
+//   [first, last)   alloc
+template <typename Alloc, typename Type>
+SIMPLE_VECTOR_CONSTEXPR void DestroyElements(Alloc& alloc, Type* first, Type* last) noexcept {
+    for (; first != last; ++first) {
+        std::allocator_traits<Alloc>::destroy(alloc, first);
+    }
+}
+
+//     dst count   args,
+//  args     .
+//      
+template <typename Alloc, typename Type, typename... Args>
+SIMPLE_VECTOR_CONSTEXPR void ConstructElements(Alloc& alloc, Type* dst, size_t count, const Args&... args) {
+    size_t i = 0;
+    try {
+        for (; i < count; ++i) {
+            std::allocator_traits<Alloc>::construct(alloc, dst + i, args...);
+        }
+    }
+    catch (...) {
+        DestroyElements(alloc, dst, dst + i);
+        throw;
+    }
+}
+
+//     dst   [first, last)
+// (  ,   std::move_iterator).     .
+//      
+template <typename Alloc, typename InputIt, typename Type>
+SIMPLE_VECTOR_CONSTEXPR Type* CopyElements(Alloc& alloc, InputIt first, InputIt last, Type* dst) {
+    if constexpr (std::is_trivially_copyable_v<Type> && std::is_pointer_v<InputIt>
+        && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIt>>, Type>) {
+        if (!IsConstantEvaluated()) {
+            const size_t count = last - first;
+            if (count > 0)
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(first), count * sizeof(Type));
+            return dst + count;
+        }
+    }
+    Type* current = dst;
+    try {
+        for (; first != last; ++first, ++current) {
+            std::allocator_traits<Alloc>::construct(alloc, current, *first);
+        }
+    }
+    catch (...) {
+        DestroyElements(alloc, dst, current);
+        throw;
+    }
+    return current;
+}
+
+//  count   src    dst .
+//    src  
+template <typename Alloc, typename Type>
+SIMPLE_VECTOR_CONSTEXPR void MoveElements(Alloc& alloc, Type* src, size_t count, Type* dst) {
+    if constexpr (IsTriviallyRelocatableV<Type>) {
+        if (!IsConstantEvaluated()) {
+            if (count > 0)
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(Type));
+            return;
+        }
+    }
+    CopyElements(alloc, std::make_move_iterator(src), std::make_move_iterator(src + count), dst);
+    DestroyElements(alloc, src, src + count);
+}
+
+//       ,     
+//    ,   ( std::move_if_noexcept)
+template <typename Type>
+inline constexpr bool IsMovedOnRelocationV = IsTriviallyRelocatableV<Type>
+    || std::is_nothrow_move_constructible_v<Type> || !std::is_copy_constructible_v<Type>;
+
+//      begin   :     IsMovedOnRelocationV
+template <typename Type>
+SIMPLE_VECTOR_CONSTEXPR auto RelocationIterator(Type* it) noexcept {
+    if constexpr (IsMovedOnRelocationV<Type>)
+        return std::make_move_iterator(it);
+    else
+        return static_cast<const Type*>(it);
+}
+
+//  count   src    dst  .
+//     :    ,
+//    dst  ,  src  .
+//     src  
+template <typename Alloc, typename Type>
+SIMPLE_VECTOR_CONSTEXPR void RelocateElements(Alloc& alloc, Type* src, size_t count, Type* dst) {
+    if constexpr (IsMovedOnRelocationV<Type>) {
+        MoveElements(alloc, src, count, dst);
+    }
+    else {
+        CopyElements(alloc, src, src + count, dst);
+        DestroyElements(alloc, src, src + count);
+    }
+}
+
+//   count     src  dst,   
+template <typename Type>
+SIMPLE_VECTOR_CONSTEXPR void RelocateOverlapping(Type* src, size_t count, Type* dst) noexcept {
+    static_assert(IsTriviallyRelocatableV<Type>);
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+    //      ,      ,
+    //      
+    if (std::is_constant_evaluated()) {
+        if (dst < src) {
+            for (size_t i = 0; i < count; ++i) {
+                std::construct_at(dst + i, std::move(src[i]));
+                std::destroy_at(src + i);
+            }
+        }
+        else {
+            for (size_t i = count; i > 0; --i) {
+                std::construct_at(dst + i - 1, std::move(src[i - 1]));
+                std::destroy_at(src + i - 1);
+            }
+        }
+        return;
+    }
+#endif
+    if (count > 0)
+        std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(Type));
+}
+
+// ,      :   ==   memcmp
+template <typename Type>
+inline constexpr bool IsBitwiseComparableV = std::is_integral_v<Type> || std::is_same_v<Type, std::byte>;
+
+// ,        memcmp:  
+template <typename Type>
+inline constexpr bool IsByteOrderedV = IsBitwiseComparableV<Type> && sizeof(Type) == 1 && !std::is_signed_v<Type>;
+
+//   count   lhs[i]  rhs[i]
+template <typename Type>
+SIMPLE_VECTOR_CONSTEXPR bool EqualElements(const Type* lhs, const Type* rhs, size_t count) {
+    if constexpr (IsBitwiseComparableV<Type>) {
+        if (!IsConstantEvaluated())
+            return count == 0 || std::memcmp(lhs, rhs, count * sizeof(Type)) == 0;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!(lhs[i] == rhs[i]))
+            return false;
+    }
+    return true;
+}
+
+//   [lhs, lhs + lhs_count)  [rhs, rhs + rhs_count)   .
+//   ,  lhs ,      ,  
+template <typename Type>
+SIMPLE_VECTOR_CONSTEXPR int CompareElements(const Type* lhs, size_t lhs_count, const Type* rhs, size_t rhs_count) {
+    const size_t common = std::min(lhs_count, rhs_count);
+    size_t i = 0;
+    if constexpr (IsByteOrderedV<Type>) {
+        if (!IsConstantEvaluated()) {
+            const int result = common == 0 ? 0 : std::memcmp(lhs, rhs, common);
+            if (result != 0)
+                return result;
+            i = common;
+        }
+    }
+    else if constexpr (IsBitwiseComparableV<Type>) {
+        if (!IsConstantEvaluated()) {
+            //     memcmp,      
+            constexpr size_t kBlock = 256 / sizeof(Type) > 0 ? 256 / sizeof(Type) : 1;
+            while (i + kBlock <= common && std::memcmp(lhs + i, rhs + i, kBlock * sizeof(Type)) == 0) {
+                i += kBlock;
+            }
+        }
+    }
+    for (; i < common; ++i) {
+        if (lhs[i] < rhs[i])
+            return -1;
+        if (rhs[i] < lhs[i])
+            return 1;
+    }
+    return lhs_count < rhs_count ? -1 : lhs_count > rhs_count ? 1 : 0;
+}
+
+//            ,
+//  (, std::pmr   )     .
+//       , :
+// template <typename Type> struct IsParallelSafeAllocator<MyAllocator<Type>> : std::true_type {};
+template <typename Alloc>
+struct IsParallelSafeAllocator : std::bool_constant<std::allocator_traits<Alloc>::is_always_equal::value> {
+};
+
+template <typename Alloc>
+inline constexpr bool IsParallelSafeAllocatorV = IsParallelSafeAllocator<Alloc>::value;
+
+//      dst count   create(first, last, dst + first),
+//       .      ,
+//       
+template <typename Alloc, typename Type, typename Create>
+void ParallelCreateElements(const Parallel& policy, Alloc& alloc, Type* dst, size_t count, Create create) {
+    const size_t chunks = IsParallelSafeAllocatorV<Alloc> ? ParallelChunkCount(policy, count) : 1;
+    if (chunks <= 1) {
+        create(size_t(0), count, dst);
+        return;
+    }
+
+    std::unique_ptr<bool[]> done(new bool[chunks]());
+    try {
+        ParallelForChunks(chunks, count, [&](size_t index, size_t first, size_t last) {
+            create(first, last, dst + first);
+            done[index] = true;
+        });
+    }
+    catch (...) {
+        for (size_t i = 0; i < chunks; ++i) {
+            if (done[i])
+                DestroyElements(alloc, dst + count * i / chunks, dst + count * (i + 1) / chunks);
+        }
+        throw;
+    }
+}
+
+//   CopyElements    [src, src + count)
+template <typename Alloc, typename Type>
+void ParallelCopyElements(const Parallel& policy, Alloc& alloc, const Type* src, size_t count, Type* dst) {
+    ParallelCreateElements(policy, alloc, dst, count, [&alloc, src](size_t first, size_t last, Type* chunk_dst) {
+        CopyElements(alloc, src + first, src + last, chunk_dst);
+    });
+}
+
+//   ConstructElements   value
+template <typename Alloc, typename Type>
+void ParallelFillElements(const Parallel& policy, Alloc& alloc, Type* dst, size_t count, const Type& value) {
+    ParallelCreateElements(policy, alloc, dst, count, [&alloc, &value](size_t first, size_t last, Type* chunk_dst) {
+        ConstructElements(alloc, chunk_dst, last - first, value);
+    });
+}
+
+//      Alloc.    Type,
+//         (   std::pmr::polymorphic_allocator).
+// Growth     (. growth_policy.h).
+//  SIMPLE_VECTOR_ENABLE_STATS       (. simple_vector_stats.h)
+template <typename Type, typename Alloc = std::allocator<Type>, typename Growth = GrowthDouble>
+class SimpleVector : private SimpleVectorStatsRecorder<> {
+    using AllocTraits = typename std::allocator_traits<Alloc>::template rebind_traits<Type>;
+
 public:
+    using AllocatorType = typename AllocTraits::allocator_type;
     using Iterator = Type*;
     using ConstIterator = const Type*;
 
-    SimpleVector() noexcept = default;
+    //   ;  SIMPLE_VECTOR_ENABLE_STATS  
+    using SimpleVectorStatsRecorder<>::GetStats;
+
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector() noexcept(noexcept(AllocatorType())) = default;
+
+    //   ,      alloc
+    SIMPLE_VECTOR_CONSTEXPR explicit SimpleVector(const AllocatorType& alloc) noexcept
+        :items_(alloc)
+    {
+    }
 
     //    size ,    
-    explicit SimpleVector(size_t size)
-        :size_(size), capacity_(size), items_(size)
+    SIMPLE_VECTOR_CONSTEXPR explicit SimpleVector(size_t size, const AllocatorType& alloc = AllocatorType())
+        :capacity_(size), items_(size, alloc)
     {
-        std::fill(&items_[0], &items_[size], Type());
+        OnInitialAllocation();
+        ConstructElements(GetAlloc(), items_.Get(), size);
+        size_ = size;
     }
 
     //    size ,   value
-    SimpleVector(size_t size, const Type& value)
-        :size_(size), capacity_(size), items_(size)
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(size_t size, const Type& value, const AllocatorType& alloc = AllocatorType())
+        :capacity_(size), items_(size, alloc)
     {
-        std::fill(&items_[0], &items_[size], value);
+        OnInitialAllocation();
+        ConstructElements(GetAlloc(), items_.Get(), size, value);
+        this->OnCopies(size);
+        size_ = size;
     }
 
     //    std::initializer_list
-    SimpleVector(std::initializer_list<Type> init)
-        :size_(init.size()), capacity_(init.size()), items_(init.size())
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(std::initializer_list<Type> init, const AllocatorType& alloc = AllocatorType())
+        :capacity_(init.size()), items_(init.size(), alloc)
     {
-        uint64_t i = 0;
-        for (auto const& value : init) {
-            items_[i] = value;
-            ++i;
-        }
+        OnInitialAllocation();
+        CopyElements(GetAlloc(), init.begin(), init.end(), items_.Get());
+        this->OnCopies(init.size());
+        size_ = init.size();
     }
 
-    SimpleVector(const SimpleVector& other)
-        :size_(other.size_), capacity_(other.size_)
-    {    
-        ArrayPtr<Type> temp(other.size_);
-        std::copy(other.begin(), other.end(), &temp[0]);
-        items_.swap(temp);
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(const SimpleVector& other)
+        :SimpleVector(other, AllocTraits::select_on_container_copy_construction(other.items_.GetAllocator()))
+    {
     }
 
-    SimpleVector& operator=(const SimpleVector& rhs) {
-        assert(this->items_.Get() != rhs.items_.Get());
+    //  other,    alloc
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(const SimpleVector& other, const AllocatorType& alloc)
+        :capacity_(other.size_), items_(other.size_, alloc)
+    {
+        OnInitialAllocation();
+        CopyElements(GetAlloc(), other.begin(), other.end(), items_.Get());
+        this->OnCopies(other.size_);
+        size_ = other.size_;
+    }
 
-        ArrayPtr<Type> temp(rhs.size_);
-        std::copy(rhs.begin(), rhs.end(), &temp[0]);
-        items_.swap(temp);
-        size_ = rhs.size_;
-        capacity_ = rhs.size_;
+    //    size  value,    (. simple_vector_parallel.h)
+    SimpleVector(size_t size, const Type& value, const Parallel& policy, const AllocatorType& alloc = AllocatorType())
+        :capacity_(size), items_(size, alloc)
+    {
+        OnInitialAllocation();
+        ParallelFillElements(policy, GetAlloc(), items_.Get(), size, value);
+        this->OnCopies(size);
+        size_ = size;
+    }
+
+    //  other  (. simple_vector_parallel.h)
+    SimpleVector(const SimpleVector& other, const Parallel& policy)
+        :SimpleVector(other, policy, AllocTraits::select_on_container_copy_construction(other.items_.GetAllocator()))
+    {
+    }
+
+    //  other ,    alloc
+    SimpleVector(const SimpleVector& other, const Parallel& policy, const AllocatorType& alloc)
+        :capacity_(other.size_), items_(other.size_, alloc)
+    {
+        OnInitialAllocation();
+        ParallelCopyElements(policy, GetAlloc(), other.items_.Get(), other.size_, items_.Get());
+        this->OnCopies(other.size_);
+        size_ = other.size_;
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector& operator=(const SimpleVector& rhs) {
+        if (this == &rhs)
+            return *this;
+
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+            SimpleVector temp(rhs, rhs.items_.GetAllocator());
+            DestroyElements(GetAlloc(), begin(), end());
+            size_ = 0;
+            *this = std::move(temp);
+        }
+        else {
+            SimpleVector temp(rhs, GetAlloc());
+            swap(temp);
+        }
         return *this;
     }
 
-    SimpleVector(ReserveProxyObj const& obj)
-        :capacity_(obj.size_), items_(obj.size_)
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(ReserveProxyObj const& obj, const AllocatorType& alloc = AllocatorType())
+        :capacity_(obj.size_), items_(obj.size_, alloc)
     {
+        OnInitialAllocation();
     }
 
-    SimpleVector(SimpleVector&& other) noexcept
-        :size_(other.size_), capacity_(other.capacity_)
+    //      [first, last).
+    //  forward-    
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(InputIt first, InputIt last, const AllocatorType& alloc = AllocatorType())
+        :items_(alloc)
+    {
+        if constexpr (IsForwardIteratorV<InputIt>) {
+            const size_t count = std::distance(first, last);
+            if (count > 0)
+                Reserve(count);
+        }
+        try {
+            Append(first, last);
+        }
+        catch (...) {
+            Clear();
+            throw;
+        }
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(SimpleVector&& other) noexcept
+        :size_(other.size_), capacity_(other.capacity_), items_(std::move(other.items_))
     {
-        this->items_ = std::move(other.items_);
         other.size_ = 0;
         other.capacity_ = 0;
 
     };
-    SimpleVector& operator=(SimpleVector&& other) noexcept {
+    //   other,        .
+    //        
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector& operator=(SimpleVector&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value
+        || AllocTraits::is_always_equal::value) {
+        if (this == &other)
+            return *this;
+
+        if constexpr (!AllocTraits::propagate_on_container_move_assignment::value
+            && !AllocTraits::is_always_equal::value) {
+            if (GetAlloc() != other.GetAlloc()) {
+                Clear();
+                Reserve(other.size_);
+                CopyElements(GetAlloc(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), begin());
+                this->OnMoves(other.size_);
+                size_ = other.size_;
+                other.Clear();
+                return *this;
+            }
+        }
+
+        DestroyElements(GetAlloc(), begin(), end());
         this->items_ = std::move(other.items_);
 
         this->size_ = std::move(other.size_);
@@ -107,36 +470,45 @@ public:
         return *this;
     }
 
+    SIMPLE_VECTOR_CONSTEXPR ~SimpleVector() {
+        DestroyElements(GetAlloc(), begin(), end());
+    }
+
+    //   ,     
+    SIMPLE_VECTOR_CONSTEXPR AllocatorType GetAllocator() const noexcept {
+        return items_.GetAllocator();
+    }
+
     //     
-    size_t GetSize() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR size_t GetSize() const noexcept {
         return size_;
     }
 
     //   
-    size_t GetCapacity() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR size_t GetCapacity() const noexcept {
         return capacity_;
     }
 
     // ,   
-    bool IsEmpty() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR bool IsEmpty() const noexcept {
         return !size_;
     }
 
     //       index
-    Type& operator[](size_t index) noexcept {
+    SIMPLE_VECTOR_CONSTEXPR Type& operator[](size_t index) noexcept {
         assert(index < size_);
         return items_[index];
     }
 
     //        index
-    const Type& operator[](size_t index) const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR const Type& operator[](size_t index) const noexcept {
         assert(index < size_);
         return items_[index];
     }
 
     //        index
     //   std::out_of_range,  index >= size
-    Type& At(size_t index) {
+    SIMPLE_VECTOR_CONSTEXPR Type& At(size_t index) {
         if (index >= size_)
             throw std::out_of_range("Element's index is incorrect (bigger than size)");
         return items_[index];
@@ -144,192 +516,739 @@ public:
 
     //        index
     //   std::out_of_range,  index >= size
-    const Type& At(size_t index) const {
+    SIMPLE_VECTOR_CONSTEXPR const Type& At(size_t index) const {
         if (index >= size_)
             throw std::out_of_range("Element's index is incorrect (bigger than size)");
         return items_[index];
     }
 
-    //   ,    
-    void Clear() noexcept {
-        this->Resize(0);
+    //   ,    .
+    //  ,    
+    SIMPLE_VECTOR_CONSTEXPR void Clear() noexcept {
+        DestroyElements(GetAlloc(), begin(), end());
+        size_ = 0;
     }
 
     //   .
     //            Type
-    void Resize(size_t new_size) {
+    SIMPLE_VECTOR_CONSTEXPR void Resize(size_t new_size) {
         if (new_size == size_)
             return;
-        if (new_size < size_)
-            size_ = new_size;
-        if (new_size > size_ && new_size <= capacity_) {
-            Type* test = &items_[6];
-            FillByMove(&items_[size_], &items_[new_size], Type());
-            size_ = new_size;
-        }
-        if (new_size > capacity_) {
-            Reserve(std::max(capacity_ * 2, new_size));
+        if (new_size < size_) {
+            DestroyElements(GetAlloc(), begin() + new_size, end());
             size_ = new_size;
+            return;
         }
+        if (new_size > capacity_)
+            Reserve(NextCapacity(new_size));
+        ConstructElements(GetAlloc(), end(), new_size - size_);
+        size_ = new_size;
     }
 
-    void PopBack() noexcept {
+    SIMPLE_VECTOR_CONSTEXPR void PopBack() noexcept {
         if (size_ == 0u)
             return;
         --size_;
+        AllocTraits::destroy(GetAlloc(), end());
     }
 
-    Iterator Erase(ConstIterator pos) {
+    SIMPLE_VECTOR_CONSTEXPR Iterator Erase(ConstIterator pos) {
         assert(pos >= begin() && pos < end());
-        auto it = &items_[std::distance(cbegin(), pos)];
-        auto next_it = std::next(it);
-        for (auto temp_it = it; next_it != cend(); ++temp_it, ++next_it) {
-            std::exchange(*temp_it, std::move(*next_it));
+        auto it = begin() + std::distance(cbegin(), pos);
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            AllocTraits::destroy(GetAlloc(), it);
+            RelocateOverlapping(std::next(it), std::distance(std::next(it), end()), it);
+            --size_;
         }
-        --size_;
+        else {
+            std::move(std::next(it), end(), it);
+            PopBack();
+        }
+        this->OnMoves(std::distance(it, end()));
         return it;
     }
 
-    void PushBack(const Type& value) {
+    //   pos  O(1):      ,
+    //     .    ,   
+    SIMPLE_VECTOR_CONSTEXPR Iterator SwapErase(ConstIterator pos) {
+        assert(pos >= begin() && pos < end());
+        Iterator it = begin() + std::distance(cbegin(), pos);
+        Iterator last = std::prev(end());
+        if (it == last) {
+            PopBack();
+            return end();
+        }
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            AllocTraits::destroy(GetAlloc(), it);
+            RelocateOverlapping(last, 1, it);
+            --size_;
+        }
+        else {
+            *it = std::move(*last);
+            PopBack();
+        }
+        this->OnMoves(1);
+        return it;
+    }
+
+    //   [first, last),    .
+    //    ,   
+    SIMPLE_VECTOR_CONSTEXPR Iterator Erase(ConstIterator first, ConstIterator last) {
+        assert(first >= begin() && first <= last && last <= end());
+        Iterator erase_first = begin() + std::distance(cbegin(), first);
+        Iterator erase_last = begin() + std::distance(cbegin(), last);
+        if (erase_first == erase_last)
+            return erase_first;
+
+        const size_t tail = std::distance(erase_last, end());
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            DestroyElements(GetAlloc(), erase_first, erase_last);
+            RelocateOverlapping(erase_last, tail, erase_first);
+        }
+        else {
+            Iterator new_end = std::move(erase_last, end(), erase_first);
+            DestroyElements(GetAlloc(), new_end, end());
+        }
+        size_ -= std::distance(erase_first, erase_last);
+        this->OnMoves(tail);
+        return erase_first;
+    }
+
+    //   ,   pred  true,     .
+    //    .   
+    template <typename Predicate>
+    SIMPLE_VECTOR_CONSTEXPR size_t EraseIf(Predicate pred) {
+        Iterator first_removed = std::find_if(begin(), end(), pred);
+        if (first_removed == end())
+            return 0;
+        // pred       
+        Iterator new_end = first_removed;
+        for (Iterator it = std::next(first_removed); it != end(); ++it) {
+            if (!pred(*it))
+                *new_end++ = std::move(*it);
+        }
+        const size_t removed = std::distance(new_end, end());
+        DestroyElements(GetAlloc(), new_end, end());
+        size_ -= removed;
+        this->OnMoves(std::distance(first_removed, new_end));
+        return removed;
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void PushBack(const Type& value) {
+        EmplaceBack(value);
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void PushBack(Type&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    //    args       .
+    //     
+    template <typename... Args>
+    SIMPLE_VECTOR_CONSTEXPR Type& EmplaceBack(Args&&... args) {
         if (size_ == capacity_)
-            Reserve(capacity_ * 2);
-        items_[size_] = value;
+            return *ReallocateAndEmplace(size_, std::forward<Args>(args)...);
+        AllocTraits::construct(GetAlloc(), end(), std::forward<Args>(args)...);
         ++size_;
+        return *std::prev(end());
     }
 
-    void PushBack(Type&& value) {
+    //    args   pos.
+    //     
+    template <typename... Args>
+    SIMPLE_VECTOR_CONSTEXPR Iterator Emplace(ConstIterator pos, Args&&... args) {
+        assert(pos >= begin() && pos <= end());
+        const size_t index = std::distance(cbegin(), pos);
         if (size_ == capacity_)
-            Reserve(capacity_ * 2);
-        std::exchange(items_[size_], std::move(value));
+            return ReallocateAndEmplace(index, std::forward<Args>(args)...);
+        if (index == size_)
+            return &EmplaceBack(std::forward<Args>(args)...);
+
+        // args     ,      
+        Type value(std::forward<Args>(args)...);
+        Iterator pos2 = begin() + index;
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            RelocateOverlapping(pos2, size_ - index, pos2 + 1);
+            try {
+                AllocTraits::construct(GetAlloc(), pos2, std::move(value));
+            }
+            catch (...) {
+                RelocateOverlapping(pos2 + 1, size_ - index, pos2);
+                throw;
+            }
+        }
+        else {
+            //       :      ,
+            //       ,  libstdc++
+            AllocTraits::construct(GetAlloc(), end(), std::move(*std::prev(end())));
+            ++size_;
+            this->OnMoves(size_ - 1 - index);
+            std::move_backward(pos2, end() - 2, end() - 1);
+            *pos2 = std::move(value);
+            return pos2;
+        }
+        this->OnMoves(size_ - index);
         ++size_;
+        return pos2;
     }
 
     //   value   pos.
     //     
     //        ,
-    //     ,     0   1
-    Iterator Insert(ConstIterator pos, const Type& value) {
-        assert(pos >= begin() && pos < end());
-        auto shift = std::distance(cbegin(), pos);
-        if (size_ == capacity_)
-            Reserve(capacity_ * 2);
-        auto pos2{ const_cast<Iterator>(std::next(cbegin(), shift)) };
-        
-        std::copy_backward(pos2, end(), std::next(end()));
-        *pos2 = value;
-        ++size_;
-        return pos2;
+    //      Growth (  ,     0   1)
+    SIMPLE_VECTOR_CONSTEXPR Iterator Insert(ConstIterator pos, const Type& value) {
+        //  value   ,  value     ,
+        //    ,   
+        return Emplace(pos, value);
     }
 
-    Iterator Insert(ConstIterator pos, Type&& value) {
-        assert(pos >= begin() && pos < end());
-        auto shift = std::distance(cbegin(), pos);
-        if (size_ == capacity_)
-            Reserve(capacity_ * 2);
-        auto pos2{ const_cast<Iterator>(std::next(cbegin(), shift)) };
+    SIMPLE_VECTOR_CONSTEXPR Iterator Insert(ConstIterator pos, Type&& value) {
+        return Emplace(pos, std::move(value));
+    }
 
-        std::move_backward(pos2, end(), std::next(end()));
-        *pos2 = std::move(value);
-        ++size_;
-        return pos2;
+    //      [first, last).
+    //  forward-      
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SIMPLE_VECTOR_CONSTEXPR void Append(InputIt first, InputIt last) {
+        if constexpr (IsForwardIteratorV<InputIt>) {
+            const size_t count = std::distance(first, last);
+            if (count == 0)
+                return;
+            if (size_ + count > capacity_) {
+                ReallocateAndInsertRange(size_, first, count);
+                return;
+            }
+            CopyElements(GetAlloc(), first, last, end());
+            OnRangeConstructed<InputIt>(count);
+            size_ += count;
+        }
+        else {
+            for (; first != last; ++first) {
+                EmplaceBack(*first);
+            }
+        }
+    }
+
+    //    [first, last)  pos      .
+    //  forward-      ,     
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SIMPLE_VECTOR_CONSTEXPR Iterator InsertRange(ConstIterator pos, InputIt first, InputIt last) {
+        assert(pos >= begin() && pos <= end());
+        const size_t index = std::distance(cbegin(), pos);
+        if constexpr (!IsForwardIteratorV<InputIt>) {
+            //   :       
+            const size_t old_size = size_;
+            Append(first, last);
+            std::rotate(begin() + index, begin() + old_size, end());
+            return begin() + index;
+        }
+        else {
+            const size_t count = std::distance(first, last);
+            if (count == 0)
+                return begin() + index;
+            if (size_ + count > capacity_)
+                return ReallocateAndInsertRange(index, first, count);
+            if (index == size_) {
+                Append(first, last);
+                return begin() + index;
+            }
+            if (RangeOverlaps(first, last)) {
+                //      ,    
+                SimpleVector temp(first, last, GetAlloc());
+                return InsertRange(pos, std::make_move_iterator(temp.begin()), std::make_move_iterator(temp.end()));
+            }
+
+            Iterator gap = begin() + index;
+            const size_t tail = size_ - index;
+            this->OnMoves(tail);
+            OnRangeConstructed<InputIt>(count);
+            if constexpr (IsTriviallyRelocatableV<Type>) {
+                RelocateOverlapping(gap, tail, gap + count);
+                try {
+                    CopyElements(GetAlloc(), first, last, gap);
+                }
+                catch (...) {
+                    RelocateOverlapping(gap + count, tail, gap);
+                    throw;
+                }
+                size_ += count;
+            }
+            else if (tail > count) {
+                //  count     ,   
+                Iterator old_end = end();
+                CopyElements(GetAlloc(), std::make_move_iterator(old_end - count), std::make_move_iterator(old_end), old_end);
+                size_ += count;
+                std::move_backward(gap, old_end - count, old_end);
+                std::copy(first, last, gap);
+            }
+            else {
+                //  ,    ,     
+                auto middle = std::next(first, tail);
+                Iterator new_end = CopyElements(GetAlloc(), middle, last, end());
+                try {
+                    CopyElements(GetAlloc(), std::make_move_iterator(gap), std::make_move_iterator(end()), new_end);
+                }
+                catch (...) {
+                    DestroyElements(GetAlloc(), end(), new_end);
+                    throw;
+                }
+                size_ += count;
+                std::copy(first, middle, gap);
+            }
+            return begin() + index;
+        }
+    }
+
+    //      [first, last).
+    //      ,   
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SIMPLE_VECTOR_CONSTEXPR void Assign(InputIt first, InputIt last) {
+        if constexpr (IsForwardIteratorV<InputIt>) {
+            if (static_cast<size_t>(std::distance(first, last)) <= capacity_ && !RangeOverlaps(first, last)) {
+                Clear();
+                Append(first, last);
+                return;
+            }
+        }
+        SimpleVector temp(first, last, GetAlloc());
+        swap(temp);
+    }
+
+    //     (. simple_vector_parallel.h)
+    void Assign(const SimpleVector& other, const Parallel& policy) {
+        if (this == &other)
+            return;
+
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+            SimpleVector temp(other, policy, other.items_.GetAllocator());
+            DestroyElements(GetAlloc(), begin(), end());
+            size_ = 0;
+            *this = std::move(temp);
+        }
+        else {
+            SimpleVector temp(other, policy, GetAlloc());
+            swap(temp);
+        }
     }
 
     //     
     //       (  ) nullptr
-    Iterator begin() noexcept {
-        return &items_[0];
+    SIMPLE_VECTOR_CONSTEXPR Iterator begin() noexcept {
+        return items_.Get();
     }
 
     //    ,   
     //       (  ) nullptr
-    Iterator end() noexcept {
-        return &items_[size_];
+    SIMPLE_VECTOR_CONSTEXPR Iterator end() noexcept {
+        return items_.Get() + size_;
     }
 
     //      
     //       (  ) nullptr
-    ConstIterator begin() const noexcept {
-        return &items_[0];
+    SIMPLE_VECTOR_CONSTEXPR ConstIterator begin() const noexcept {
+        return items_.Get();
     }
 
     //    ,   
     //       (  ) nullptr
-    ConstIterator end() const noexcept {
-        return &items_[size_];
+    SIMPLE_VECTOR_CONSTEXPR ConstIterator end() const noexcept {
+        return items_.Get() + size_;
     }
 
     //      
     //       (  ) nullptr
-    ConstIterator cbegin() const noexcept {
-        return &items_[0];
+    SIMPLE_VECTOR_CONSTEXPR ConstIterator cbegin() const noexcept {
+        return items_.Get();
     }
 
     //    ,   
     //       (  ) nullptr
-    ConstIterator cend() const noexcept {
-        return &items_[size_];
+    SIMPLE_VECTOR_CONSTEXPR ConstIterator cend() const noexcept {
+        return items_.Get() + size_;
     }
 
-    void swap(SimpleVector& rhs) noexcept {
+    SIMPLE_VECTOR_CONSTEXPR void swap(SimpleVector& rhs) noexcept {
         this->items_.swap(rhs.items_);
         std::swap(this->size_, rhs.size_);
         std::swap(this->capacity_, rhs.capacity_);
     }
 
-    void Reserve(size_t new_capacity) {
+    SIMPLE_VECTOR_CONSTEXPR void Reserve(size_t new_capacity) {
         if (new_capacity == 0u)
             new_capacity = 1;
         if (new_capacity <= capacity_)
             return;
-        ArrayPtr<Type> temp(new_capacity);
-        std::move(begin(), end(), &temp[0]);
-        FillByMove(&temp[size_], &temp[new_capacity], Type());
+        if (TryReallocateInPlace(new_capacity))
+            return;
+        //    ,  [size_, new_capacity)  
+        ArrayPtr<Type, AllocatorType> temp = AllocateStorage(new_capacity);
+        RelocateElements(GetAlloc(), begin(), size_, temp.Get());
+        OnRelocated(size_);
         items_.swap(temp);
         capacity_ = new_capacity;
     }
 
-    private: 
+    //     .     
+    SIMPLE_VECTOR_CONSTEXPR void ShrinkToFit() {
+        if (capacity_ == size_)
+            return;
+        if (size_ == 0u) {
+            ArrayPtr<Type, AllocatorType> empty(GetAlloc());
+            items_.swap(empty);
+            capacity_ = 0;
+            return;
+        }
+        if (TryReallocateInPlace(size_))
+            return;
+        ArrayPtr<Type, AllocatorType> temp = AllocateStorage(size_);
+        RelocateElements(GetAlloc(), begin(), size_, temp.Get());
+        OnRelocated(size_);
+        items_.swap(temp);
+        capacity_ = size_;
+    }
+
+    //  ShrinkToFit,     ratio  .
+    //  true,    
+    SIMPLE_VECTOR_CONSTEXPR bool ShrinkIf(double ratio) {
+        if (capacity_ == size_ || static_cast<double>(size_) >= static_cast<double>(capacity_) * ratio)
+            return false;
+        ShrinkToFit();
+        return true;
+    }
+
+    //    ,      [size, capacity),
+    //   :    ,       .
+    //    ,     .
+    //    ;    madvise   
+    size_t DiscardUnusedTail() noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+        if (!items_)
+            return 0;
+        const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        const uintptr_t first = (reinterpret_cast<uintptr_t>(end()) + page - 1) & ~(page - 1);
+        const uintptr_t last = reinterpret_cast<uintptr_t>(begin() + capacity_) & ~(page - 1);
+        if (last <= first)
+            return 0;
+        if (madvise(reinterpret_cast<void*>(first), last - first, MADV_DONTNEED) != 0)
+            return 0;
+        return last - first;
+#else
+        return 0;
+#endif
+    }
+
+    //        .
+    //      chunk       :
+    //     ,        
+    // (  ,  Commit   ).
+    //  prefetch_distance > 0         .
+    //   ,      ;     
+    class BackInserter {
+    public:
+        static constexpr size_t kDefaultChunk = 256;
+
+        SIMPLE_VECTOR_CONSTEXPR explicit BackInserter(SimpleVector& vector, size_t chunk = kDefaultChunk, size_t prefetch_distance = 0) noexcept
+            :vector_(vector), chunk_(chunk == 0 ? 1 : chunk), prefetch_distance_(prefetch_distance)
+        {
+            Rewind();
+        }
+
+        BackInserter(const BackInserter&) = delete;
+        BackInserter& operator=(const BackInserter&) = delete;
+
+        SIMPLE_VECTOR_CONSTEXPR ~BackInserter() {
+            Commit();
+        }
+
+        //    args        
+        template <typename... Args>
+        SIMPLE_VECTOR_CONSTEXPR Type& Emplace(Args&&... args) {
+            if (cursor_ == limit_)
+                Refill(1);
+            Prefetch();
+            AllocTraits::construct(vector_.GetAlloc(), cursor_, std::forward<Args>(args)...);
+            return *cursor_++;
+        }
+
+        SIMPLE_VECTOR_CONSTEXPR void PushBack(const Type& value) {
+            Emplace(value);
+        }
+
+        SIMPLE_VECTOR_CONSTEXPR void PushBack(Type&& value) {
+            Emplace(std::move(value));
+        }
+
+        //     count  ,   memcpy     .
+        //  count         .
+        //     :    ,    
+        SIMPLE_VECTOR_CONSTEXPR Type* Claim(size_t count) {
+            static_assert(std::is_trivially_copyable_v<Type>, "Raw write positions require a trivially copyable type");
+            if (static_cast<size_t>(limit_ - cursor_) < count)
+                Refill(count);
+            Prefetch();
+            return std::exchange(cursor_, cursor_ + count);
+        }
+
+        //  ,     
+        SIMPLE_VECTOR_CONSTEXPR size_t GetPending() const noexcept {
+            return cursor_ - vector_.end();
+        }
+
+        //     
+        SIMPLE_VECTOR_CONSTEXPR void Commit() noexcept {
+            vector_.size_ += GetPending();
+        }
+
+    private:
+        SIMPLE_VECTOR_CONSTEXPR void Rewind() noexcept {
+            cursor_ = vector_.end();
+            limit_ = vector_.begin() + vector_.capacity_;
+        }
+
+        //         max(count, chunk) .
+        //       ,    
+        SIMPLE_VECTOR_CONSTEXPR void Refill(size_t count) {
+            Commit();
+            const size_t required = vector_.size_ + std::max(count, chunk_);
+            if (required > vector_.capacity_)
+                vector_.Reserve(vector_.NextCapacity(required));
+            Rewind();
+        }
+
+        //       
+        SIMPLE_VECTOR_CONSTEXPR void Prefetch() const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            if (prefetch_distance_ != 0 && !IsConstantEvaluated() && prefetch_distance_ < static_cast<size_t>(limit_ - cursor_))
+                __builtin_prefetch(cursor_ + prefetch_distance_, 1);
+#endif
+        }
+
+        SimpleVector& vector_;
+        size_t chunk_;
+        size_t prefetch_distance_;
+        Type* cursor_ = nullptr;
+        Type* limit_ = nullptr;
+    };
+
+    private:
+        SIMPLE_VECTOR_CONSTEXPR AllocatorType& GetAlloc() noexcept {
+            return items_.GetAllocator();
+        }
+
+        SIMPLE_VECTOR_CONSTEXPR size_t NextCapacity(size_t required) const noexcept {
+            return Growth::NextCapacity(capacity_, required, sizeof(Type));
+        }
+
+        SIMPLE_VECTOR_CONSTEXPR void OnInitialAllocation() noexcept {
+            if (capacity_ > 0)
+                this->OnAllocate(capacity_, capacity_ * sizeof(Type));
+        }
+
+        //   std::move_iterator  ,   
+        template <typename It>
+        SIMPLE_VECTOR_CONSTEXPR void OnRangeConstructed(size_t count) noexcept {
+            if constexpr (std::is_rvalue_reference_v<typename std::iterator_traits<It>::reference>)
+                this->OnMoves(count);
+            else
+                this->OnCopies(count);
+        }
+
+        //          IsMovedOnRelocationV
+        SIMPLE_VECTOR_CONSTEXPR void OnRelocated(size_t count) noexcept {
+            if constexpr (IsMovedOnRelocationV<Type>)
+                this->OnMoves(count);
+            else
+                this->OnCopies(count);
+        }
+
+        //     capacity    
+        SIMPLE_VECTOR_CONSTEXPR ArrayPtr<Type, AllocatorType> AllocateStorage(size_t capacity) {
+            ArrayPtr<Type, AllocatorType> storage(capacity, GetAlloc());
+            this->OnAllocate(capacity, capacity * sizeof(Type));
+            if (capacity_ > 0 && capacity > capacity_)
+                this->OnRegrowth();
+            return storage;
+        }
+
+        //         reallocate 
+        //       
+        SIMPLE_VECTOR_CONSTEXPR bool TryReallocateInPlace(size_t new_capacity) {
+            if constexpr (IsTriviallyRelocatableV<Type>) {
+                if (items_.Reallocate(new_capacity)) {
+                    this->OnAllocate(new_capacity, new_capacity * sizeof(Type));
+                    if (new_capacity > capacity_)
+                        this->OnRegrowth();
+                    capacity_ = new_capacity;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //           index
+        //    : args      
+        template <typename... Args>
+        SIMPLE_VECTOR_CONSTEXPR Iterator ReallocateAndEmplace(size_t index, Args&&... args) {
+            const size_t new_capacity = NextCapacity(size_ + 1);
+            if constexpr (IsTriviallyRelocatableV<Type> && HasReallocateV<AllocatorType>) {
+                if (items_) {
+                    // realloc   ,    
+                    Type value(std::forward<Args>(args)...);
+                    TryReallocateInPlace(new_capacity);
+                    return Emplace(cbegin() + index, std::move(value));
+                }
+            }
+            ArrayPtr<Type, AllocatorType> temp = AllocateStorage(new_capacity);
+            Type* item = temp.Get() + index;
+            AllocTraits::construct(GetAlloc(), item, std::forward<Args>(args)...);
+            RelocateAroundGap(temp, index, 1);
+            return item;
+        }
+
+        //    size_ + count ,       index
+        //      :      
+        template <typename ForwardIt>
+        SIMPLE_VECTOR_CONSTEXPR Iterator ReallocateAndInsertRange(size_t index, ForwardIt first, size_t count) {
+            const size_t new_capacity = NextCapacity(size_ + count);
+            if constexpr (IsTriviallyRelocatableV<Type> && HasReallocateV<AllocatorType>) {
+                if (items_ && !RangeOverlaps(first, std::next(first, count))) {
+                    TryReallocateInPlace(new_capacity);
+                    return InsertRange(cbegin() + index, first, std::next(first, count));
+                }
+            }
+            ArrayPtr<Type, AllocatorType> temp = AllocateStorage(new_capacity);
+            Type* gap = temp.Get() + index;
+            CopyElements(GetAlloc(), first, std::next(first, count), gap);
+            OnRangeConstructed<ForwardIt>(count);
+            RelocateAroundGap(temp, index, count);
+            return gap;
+        }
+
+        //      temp ,    [0, index)  
+        //     temp  [index, index + count),   temp  .
+        //     temp  ,      
+        SIMPLE_VECTOR_CONSTEXPR void RelocateAroundGap(ArrayPtr<Type, AllocatorType>& temp, size_t index, size_t count) {
+            Type* gap = temp.Get() + index;
+            if constexpr (IsTriviallyRelocatableV<Type>) {
+                RelocateElements(GetAlloc(), begin(), index, temp.Get());
+                RelocateElements(GetAlloc(), begin() + index, size_ - index, gap + count);
+            }
+            else {
+                try {
+                    CopyElements(GetAlloc(), RelocationIterator(begin()), RelocationIterator(begin() + index), temp.Get());
+                }
+                catch (...) {
+                    DestroyElements(GetAlloc(), gap, gap + count);
+                    throw;
+                }
+                try {
+                    CopyElements(GetAlloc(), RelocationIterator(begin() + index), RelocationIterator(end()), gap + count);
+                }
+                catch (...) {
+                    DestroyElements(GetAlloc(), temp.Get(), gap + count);
+                    throw;
+                }
+                DestroyElements(GetAlloc(), begin(), end());
+            }
+            OnRelocated(size_);
+            items_.swap(temp);
+            capacity_ = items_.GetSize();
+            size_ += count;
+        }
+
+        // ,        
+        template <typename It>
+        SIMPLE_VECTOR_CONSTEXPR bool RangeOverlaps(It first, It last) const noexcept {
+            if constexpr (std::is_pointer_v<It> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, Type>) {
+                if (first == last)
+                    return false;
+                if (IsConstantEvaluated()) {
+                    //         ,    
+                    for (ConstIterator it = begin(); it != end(); ++it) {
+                        if (it == first)
+                            return true;
+                    }
+                    return false;
+                }
+                const std::less<const Type*> less;
+                return less(first, end()) && less(begin(), last);
+            }
+            else {
+                return false;
+            }
+        }
+
         size_t size_ = 0;
         size_t capacity_ = 0;
-        ArrayPtr<Type> items_;
+        ArrayPtr<Type, AllocatorType> items_;
 };
 
-template <typename Type>
-inline bool operator==(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
+template <typename Type, typename Alloc, typename Growth>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator==(const SimpleVector<Type, Alloc, Growth>& lhs, const SimpleVector<Type, Alloc, Growth>& rhs) {
     if (lhs.GetSize() != rhs.GetSize())
         return false;
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    return EqualElements(lhs.begin(), rhs.begin(), lhs.GetSize());
 }
 
-template <typename Type>
-inline bool operator!=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    if (lhs == rhs)
-        return false;
+template <typename Type, typename Alloc, typename Growth>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator!=(const SimpleVector<Type, Alloc, Growth>& lhs, const SimpleVector<Type, Alloc, Growth>& rhs) {
     return !(lhs == rhs);
 }
 
-template <typename Type>
-inline bool operator<(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+//       (. CompareElements)
+template <typename Type, typename Alloc, typename Growth>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator<(const SimpleVector<Type, Alloc, Growth>& lhs, const SimpleVector<Type, Alloc, Growth>& rhs) {
+    return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) < 0;
 }
 
-template <typename Type>
-inline bool operator<=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    if (lhs == rhs)
-        return true;
-    return lhs < rhs;
+template <typename Type, typename Alloc, typename Growth>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator<=(const SimpleVector<Type, Alloc, Growth>& lhs, const SimpleVector<Type, Alloc, Growth>& rhs) {
+    return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) <= 0;
 }
 
-template <typename Type>
-inline bool operator>(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    if (lhs == rhs)
+template <typename Type, typename Alloc, typename Growth>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator>(const SimpleVector<Type, Alloc, Growth>& lhs, const SimpleVector<Type, Alloc, Growth>& rhs) {
+    return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) > 0;
+}
+
+template <typename Type, typename Alloc, typename Growth>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator>=(const SimpleVector<Type, Alloc, Growth>& lhs, const SimpleVector<Type, Alloc, Growth>& rhs) {
+    return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) >= 0;
+}
+
+#if defined(__cpp_lib_three_way_comparison)
+//     ,   C++20
+template <typename Type, typename Alloc, typename Growth>
+    requires std::three_way_comparable<Type>
+inline SIMPLE_VECTOR_CONSTEXPR auto operator<=>(const SimpleVector<Type, Alloc, Growth>& lhs, const SimpleVector<Type, Alloc, Growth>& rhs) {
+    if constexpr (IsBitwiseComparableV<Type>) {
+        return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) <=> 0;
+    }
+    else {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+}
+#endif
+
+//   operator== (. simple_vector_parallel.h)
+template <typename Type, typename Alloc, typename Growth>
+bool ParallelEqual(const SimpleVector<Type, Alloc, Growth>& lhs, const SimpleVector<Type, Alloc, Growth>& rhs,
+    const Parallel& policy = Parallel()) {
+    if (lhs.GetSize() != rhs.GetSize())
         return false;
-    return !(lhs < rhs);
+    return ParallelEqualRanges(policy, lhs.begin(), rhs.begin(), lhs.GetSize());
 }
 
-template <typename Type>
-inline bool operator>=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    if (lhs == rhs)
-        return true;
-    return lhs > rhs;
-}
\ No newline at end of file
+//   operator<.     ==,     <
+template <typename Type, typename Alloc, typename Growth>
+bool ParallelLess(const SimpleVector<Type, Alloc, Growth>& lhs, const SimpleVector<Type, Alloc, Growth>& rhs,
+    const Parallel& policy = Parallel()) {
+    const size_t common = std::min(lhs.GetSize(), rhs.GetSize());
+    const size_t at = ParallelMismatchIndex(policy, lhs.begin(), rhs.begin(), common);
+    if (at != common)
+        return lhs[at] < rhs[at];
+    return lhs.GetSize() < rhs.GetSize();
+}
+
+//   SimpleVector<bool>
+#include "simple_vector_bool.h"
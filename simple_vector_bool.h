@@ -0,0 +1,918 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <cstdint>
+
+#if __has_include(<bit>)
+#include <bit>
+#endif
+
+//     word
+inline size_t PopCount(uint64_t word) noexcept {
+#if defined(__cpp_lib_bitops)
+    return static_cast<size_t>(std::popcount(word));
+#elif defined(__GNUC__)
+    return static_cast<size_t>(__builtin_popcountll(word));
+#else
+    size_t result = 0;
+    for (; word != 0; word &= word - 1) {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+//     word, word != 0
+inline size_t CountTrailingZeros(uint64_t word) noexcept {
+#if defined(__cpp_lib_bitops)
+    return static_cast<size_t>(std::countr_zero(word));
+#elif defined(__GNUC__)
+    return static_cast<size_t>(__builtin_ctzll(word));
+#else
+    size_t result = 0;
+    for (; (word & 1) == 0; word >>= 1) {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+//   : 64     uint64_t,     ,     .
+// operator[]  -  . Count, FindFirst/FindNext   &=, |=, ^=   .
+//          64 ,     .
+//        ,    Count  
+template <typename Alloc, typename Growth>
+class SimpleVector<bool, Alloc, Growth> : private SimpleVectorStatsRecorder<> {
+    using Word = uint64_t;
+    using AllocTraits = typename std::allocator_traits<Alloc>::template rebind_traits<bool>;
+    using WordAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Word>;
+    using WordAllocTraits = std::allocator_traits<WordAlloc>;
+
+    static constexpr size_t kBitsPerWord = 64;
+
+    template <bool Const>
+    class BasicIterator;
+
+public:
+    using AllocatorType = typename AllocTraits::allocator_type;
+
+    // -    
+    class Reference {
+    public:
+        Reference(Word* word, Word mask) noexcept
+            :word_(word), mask_(mask)
+        {
+        }
+
+        Reference(const Reference&) = default;
+
+        operator bool() const noexcept {
+            return (*word_ & mask_) != 0;
+        }
+
+        Reference& operator=(bool value) noexcept {
+            if (value)
+                *word_ |= mask_;
+            else
+                *word_ &= ~mask_;
+            return *this;
+        }
+
+        Reference& operator=(const Reference& other) noexcept {
+            return *this = static_cast<bool>(other);
+        }
+
+        //  
+        void Flip() noexcept {
+            *word_ ^= mask_;
+        }
+
+        friend void swap(Reference lhs, Reference rhs) noexcept {
+            const bool value = lhs;
+            lhs = static_cast<bool>(rhs);
+            rhs = value;
+        }
+
+    private:
+        Word* word_;
+        Word mask_;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    // ,  FindFirst  FindNext ,     
+    static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+    //   ;  SIMPLE_VECTOR_ENABLE_STATS  
+    using SimpleVectorStatsRecorder<>::GetStats;
+
+    SimpleVector() noexcept(noexcept(WordAlloc())) = default;
+
+    //   ,      alloc
+    explicit SimpleVector(const AllocatorType& alloc) noexcept
+        :words_(WordAlloc(alloc))
+    {
+    }
+
+    //    size    false
+    explicit SimpleVector(size_t size, const AllocatorType& alloc = AllocatorType())
+        :SimpleVector(size, false, alloc)
+    {
+    }
+
+    //    size    value
+    SimpleVector(size_t size, bool value, const AllocatorType& alloc = AllocatorType())
+        :words_(WordCount(size), WordAlloc(alloc))
+    {
+        OnInitialAllocation();
+        size_ = size;
+        FillWords(0, words_.GetSize(), value);
+        ClearTail();
+    }
+
+    //    std::initializer_list
+    SimpleVector(std::initializer_list<bool> init, const AllocatorType& alloc = AllocatorType())
+        :SimpleVector(init.size(), false, alloc)
+    {
+        size_t index = 0;
+        for (bool value : init) {
+            (*this)[index++] = value;
+        }
+    }
+
+    SimpleVector(const SimpleVector& other)
+        :SimpleVector(other, AllocTraits::select_on_container_copy_construction(other.GetAllocator()))
+    {
+    }
+
+    //  other,    alloc
+    SimpleVector(const SimpleVector& other, const AllocatorType& alloc)
+        :words_(WordCount(other.size_), WordAlloc(alloc))
+    {
+        OnInitialAllocation();
+        CopyWords(other.words_.Get(), WordCount(other.size_), words_.Get());
+        size_ = other.size_;
+    }
+
+    SimpleVector(ReserveProxyObj const& obj, const AllocatorType& alloc = AllocatorType())
+        :words_(WordCount(obj.size_), WordAlloc(alloc))
+    {
+        OnInitialAllocation();
+    }
+
+    //      [first, last).
+    //  forward-    
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SimpleVector(InputIt first, InputIt last, const AllocatorType& alloc = AllocatorType())
+        :SimpleVector(alloc)
+    {
+        if constexpr (IsForwardIteratorV<InputIt>)
+            Reserve(static_cast<size_t>(std::distance(first, last)));
+        Append(first, last);
+    }
+
+    SimpleVector(SimpleVector&& other) noexcept
+        :size_(std::exchange(other.size_, 0)), words_(std::move(other.words_))
+    {
+    }
+
+    SimpleVector& operator=(const SimpleVector& rhs) {
+        if (this == &rhs)
+            return *this;
+        if constexpr (WordAllocTraits::propagate_on_container_copy_assignment::value) {
+            SimpleVector temp(rhs, rhs.GetAllocator());
+            *this = std::move(temp);
+        }
+        else {
+            SimpleVector temp(rhs, GetAllocator());
+            swap(temp);
+        }
+        return *this;
+    }
+
+    //   other,        .   
+    SimpleVector& operator=(SimpleVector&& other) noexcept(WordAllocTraits::propagate_on_container_move_assignment::value
+        || WordAllocTraits::is_always_equal::value) {
+        if (this == &other)
+            return *this;
+        if constexpr (!WordAllocTraits::propagate_on_container_move_assignment::value
+            && !WordAllocTraits::is_always_equal::value) {
+            if (words_.GetAllocator() != other.words_.GetAllocator()) {
+                size_ = 0;
+                Reserve(other.size_);
+                CopyWords(other.words_.Get(), WordCount(other.size_), words_.Get());
+                size_ = other.size_;
+                other.Clear();
+                return *this;
+            }
+        }
+        words_ = std::move(other.words_);
+        size_ = std::exchange(other.size_, 0);
+        return *this;
+    }
+
+    //   ,     
+    AllocatorType GetAllocator() const noexcept {
+        return AllocatorType(words_.GetAllocator());
+    }
+
+    //   
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    //   ,    
+    size_t GetCapacity() const noexcept {
+        return words_.GetSize() * kBitsPerWord;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    Reference operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Reference(words_.Get() + index / kBitsPerWord, BitMask(index));
+    }
+
+    bool operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return (words_[index / kBitsPerWord] & BitMask(index)) != 0;
+    }
+
+    //   std::out_of_range,  index >= size
+    Reference At(size_t index) {
+        if (index >= size_)
+            throw std::out_of_range("Element's index is incorrect (bigger than size)");
+        return (*this)[index];
+    }
+
+    bool At(size_t index) const {
+        if (index >= size_)
+            throw std::out_of_range("Element's index is incorrect (bigger than size)");
+        return (*this)[index];
+    }
+
+    //  ,   
+    void Clear() noexcept {
+        size_ = 0;
+    }
+
+    //  .     value
+    void Resize(size_t new_size, bool value = false) {
+        if (new_size <= size_) {
+            size_ = new_size;
+            ClearTail();
+            return;
+        }
+        if (new_size > GetCapacity())
+            Reserve(NextCapacity(new_size));
+        const size_t old_size = size_;
+        size_ = new_size;
+        if (value) {
+            //      ,       
+            const size_t first_word = WordCount(old_size);
+            if (old_size % kBitsPerWord != 0)
+                words_[old_size / kBitsPerWord] |= ~Word(0) << (old_size % kBitsPerWord);
+            FillWords(first_word, WordCount(new_size), true);
+            ClearTail();
+        }
+        else {
+            FillWords(WordCount(old_size), WordCount(new_size), false);
+        }
+    }
+
+    //    
+    void PushBack(bool value) {
+        if (size_ == GetCapacity())
+            Reserve(NextCapacity(size_ + 1));
+        if (size_ % kBitsPerWord == 0)
+            words_[size_ / kBitsPerWord] = 0;
+        ++size_;
+        (*this)[size_ - 1] = value;
+    }
+
+    // ""  .     
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        (*this)[size_ - 1] = false;
+        --size_;
+    }
+
+    //    ,   args,     
+    template <typename... Args>
+    Reference EmplaceBack(Args&&... args) {
+        PushBack(bool(std::forward<Args>(args)...));
+        return (*this)[size_ - 1];
+    }
+
+    //   value  pos     
+    Iterator Insert(ConstIterator pos, bool value) {
+        const size_t index = pos - cbegin();
+        OpenGap(index, 1);
+        (*this)[index] = value;
+        return Iterator(this, index);
+    }
+
+    template <typename... Args>
+    Iterator Emplace(ConstIterator pos, Args&&... args) {
+        return Insert(pos, bool(std::forward<Args>(args)...));
+    }
+
+    //      [first, last).
+    //  forward-      
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    void Append(InputIt first, InputIt last) {
+        if constexpr (IsForwardIteratorV<InputIt>) {
+            const size_t required = size_ + static_cast<size_t>(std::distance(first, last));
+            if (required > GetCapacity())
+                Reserve(NextCapacity(required));
+        }
+        for (; first != last; ++first) {
+            PushBack(static_cast<bool>(*first));
+        }
+    }
+
+    //    [first, last)  pos      .
+    //    ;       
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    Iterator InsertRange(ConstIterator pos, InputIt first, InputIt last) {
+        const size_t index = pos - cbegin();
+        if constexpr (IsForwardIteratorV<InputIt> && !std::is_same_v<InputIt, Iterator> && !std::is_same_v<InputIt, ConstIterator>) {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            OpenGap(index, count);
+            for (size_t i = index; first != last; ++first, ++i) {
+                (*this)[i] = static_cast<bool>(*first);
+            }
+        }
+        else {
+            //          ,
+            //    
+            const SimpleVector temp(first, last, GetAllocator());
+            OpenGap(index, temp.size_);
+            CopyBits(temp, 0, temp.size_, index);
+        }
+        return Iterator(this, index);
+    }
+
+    //      [first, last).
+    //      ,   
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    void Assign(InputIt first, InputIt last) {
+        if constexpr (IsForwardIteratorV<InputIt>) {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count > GetCapacity())
+                Reserve(count);
+        }
+        //    ,          
+        size_t index = 0;
+        for (; first != last && index < size_; ++first, ++index) {
+            (*this)[index] = static_cast<bool>(*first);
+        }
+        for (; first != last; ++first, ++index) {
+            PushBack(static_cast<bool>(*first));
+        }
+        size_ = index;
+        ClearTail();
+    }
+
+    //   pos     
+    Iterator Erase(ConstIterator pos) {
+        assert(pos >= cbegin() && pos < cend());
+        return Erase(pos, pos + 1);
+    }
+
+    //   [first, last),    .
+    //    ,   
+    Iterator Erase(ConstIterator first, ConstIterator last) {
+        assert(first >= cbegin() && first <= last && last <= cend());
+        const size_t index = first - cbegin();
+        const size_t tail = last - cbegin();
+        MoveBits(tail, index, size_ - tail);
+        size_ -= tail - index;
+        ClearTail();
+        return Iterator(this, index);
+    }
+
+    //   pos  O(1):      ,
+    //    .    ,   
+    Iterator SwapErase(ConstIterator pos) {
+        assert(pos >= cbegin() && pos < cend());
+        const size_t index = pos - cbegin();
+        (*this)[index] = (*this)[size_ - 1];
+        PopBack();
+        return Iterator(this, index);
+    }
+
+    //   ,   pred  true,     .
+    //   .   
+    template <typename Predicate>
+    size_t EraseIf(Predicate pred) {
+        size_t kept = 0;
+        for (size_t i = 0; i < size_; ++i) {
+            const bool value = std::as_const(*this)[i];
+            if (!pred(value))
+                (*this)[kept++] = value;
+        }
+        const size_t removed = size_ - kept;
+        size_ = kept;
+        ClearTail();
+        return removed;
+    }
+
+    //     value
+    void Fill(bool value) noexcept {
+        FillWords(0, WordCount(size_), value);
+        ClearTail();
+    }
+
+    //   
+    void FlipAll() noexcept {
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            words_[i] = ~words_[i];
+        }
+        ClearTail();
+    }
+
+    //      true
+    size_t Count() const noexcept {
+        size_t result = 0;
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            result += PopCount(words_[i]);
+        }
+        return result;
+    }
+
+    // ,       true
+    bool Any() const noexcept {
+        return FindFirst() != kNotFound;
+    }
+
+    //     true  kNotFound
+    size_t FindFirst() const noexcept {
+        return FindFrom(0);
+    }
+
+    //     true  index  kNotFound
+    size_t FindNext(size_t index) const noexcept {
+        return index + 1 >= size_ ? kNotFound : FindFrom(index + 1);
+    }
+
+    //       .
+    //   std::invalid_argument,   
+    SimpleVector& operator&=(const SimpleVector& other) {
+        return ApplyWords(other, [](Word lhs, Word rhs) { return lhs & rhs; });
+    }
+
+    SimpleVector& operator|=(const SimpleVector& other) {
+        return ApplyWords(other, [](Word lhs, Word rhs) { return lhs | rhs; });
+    }
+
+    SimpleVector& operator^=(const SimpleVector& other) {
+        return ApplyWords(other, [](Word lhs, Word rhs) { return lhs ^ rhs; });
+    }
+
+    //    ,    :  i   i % 64  i / 64
+    const uint64_t* GetWords() const noexcept {
+        return words_.Get();
+    }
+
+    //    
+    size_t GetWordCount() const noexcept {
+        return WordCount(size_);
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, size_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    void swap(SimpleVector& rhs) noexcept {
+        words_.swap(rhs.words_);
+        std::swap(size_, rhs.size_);
+    }
+
+    //    new_capacity 
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= GetCapacity())
+            return;
+        const size_t new_words = WordCount(new_capacity);
+        if (words_.Reallocate(new_words)) {
+            OnAllocation(new_words);
+            return;
+        }
+        ArrayPtr<Word, WordAlloc> temp(new_words, words_.GetAllocator());
+        OnAllocation(new_words);
+        CopyWords(words_.Get(), WordCount(size_), temp.Get());
+        words_.swap(temp);
+    }
+
+    //    ,     
+    void ShrinkToFit() {
+        const size_t used = WordCount(size_);
+        if (used == words_.GetSize())
+            return;
+        ArrayPtr<Word, WordAlloc> temp(used, words_.GetAllocator());
+        if (used > 0)
+            this->OnAllocate(used * kBitsPerWord, used * sizeof(Word));
+        CopyWords(words_.Get(), used, temp.Get());
+        words_.swap(temp);
+    }
+
+    //        ,  SimpleVector::BackInserter.
+    //      chunk       ,
+    //         (  ,  Commit   ).
+    //   ,      ;     
+    class BackInserter {
+    public:
+        static constexpr size_t kDefaultChunk = 256;
+
+        explicit BackInserter(SimpleVector& vector, size_t chunk = kDefaultChunk) noexcept
+            :vector_(vector), chunk_(chunk == 0 ? 1 : chunk)
+        {
+            Rewind();
+        }
+
+        BackInserter(const BackInserter&) = delete;
+        BackInserter& operator=(const BackInserter&) = delete;
+
+        ~BackInserter() {
+            Commit();
+        }
+
+        //  ,   args,        
+        template <typename... Args>
+        Reference Emplace(Args&&... args) {
+            const bool value = bool(std::forward<Args>(args)...);
+            if (cursor_ == limit_)
+                Refill();
+            Word* word = vector_.words_.Get() + cursor_ / kBitsPerWord;
+            //           
+            if (cursor_ % kBitsPerWord == 0)
+                *word = 0;
+            const Word mask = BitMask(cursor_++);
+            if (value)
+                *word |= mask;
+            return Reference(word, mask);
+        }
+
+        void PushBack(bool value) {
+            Emplace(value);
+        }
+
+        //  ,     
+        size_t GetPending() const noexcept {
+            return cursor_ - vector_.size_;
+        }
+
+        //     
+        void Commit() noexcept {
+            vector_.size_ = cursor_;
+        }
+
+    private:
+        void Rewind() noexcept {
+            cursor_ = vector_.size_;
+            limit_ = vector_.GetCapacity();
+        }
+
+        //         chunk 
+        void Refill() {
+            Commit();
+            const size_t required = vector_.size_ + chunk_;
+            if (required > vector_.GetCapacity())
+                vector_.Reserve(vector_.NextCapacity(required));
+            Rewind();
+        }
+
+        SimpleVector& vector_;
+        size_t chunk_;
+        size_t cursor_ = 0;
+        size_t limit_ = 0;
+    };
+
+private:
+    template <bool Const>
+    class BasicIterator {
+        using Owner = std::conditional_t<Const, const SimpleVector, SimpleVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::conditional_t<Const, bool, Reference>;
+
+        BasicIterator() noexcept = default;
+
+        BasicIterator(Owner* owner, size_t index) noexcept
+            :owner_(owner), index_(index)
+        {
+        }
+
+        //     
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            :owner_(other.owner_), index_(other.index_)
+        {
+        }
+
+        reference operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return (*owner_)[index_ + offset];
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator<=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ <= rhs.index_;
+        }
+
+        friend bool operator>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ > rhs.index_;
+        }
+
+        friend bool operator>=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ >= rhs.index_;
+        }
+
+    private:
+        template <bool>
+        friend class BasicIterator;
+
+        Owner* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    static constexpr size_t WordCount(size_t bits) noexcept {
+        return (bits + kBitsPerWord - 1) / kBitsPerWord;
+    }
+
+    static constexpr Word BitMask(size_t index) noexcept {
+        return Word(1) << (index % kBitsPerWord);
+    }
+
+    //   count  , count <= 64
+    static constexpr Word LowMask(size_t count) noexcept {
+        return count >= kBitsPerWord ? ~Word(0) : (Word(1) << count) - 1;
+    }
+
+    static void CopyWords(const Word* src, size_t count, Word* dst) noexcept {
+        if (count > 0)
+            std::memcpy(dst, src, count * sizeof(Word));
+    }
+
+    //      Growth,    
+    size_t NextCapacity(size_t required) const noexcept {
+        return Growth::NextCapacity(words_.GetSize(), WordCount(required), sizeof(Word)) * kBitsPerWord;
+    }
+
+    void OnInitialAllocation() noexcept {
+        if (words_.GetSize() > 0)
+            this->OnAllocate(GetCapacity(), words_.GetSize() * sizeof(Word));
+    }
+
+    void OnAllocation(size_t new_words) noexcept {
+        this->OnAllocate(new_words * kBitsPerWord, new_words * sizeof(Word));
+        if (words_.GetSize() > 0)
+            this->OnRegrowth();
+    }
+
+    void FillWords(size_t first, size_t last, bool value) noexcept {
+        std::fill(words_.Get() + first, words_.Get() + last, value ? ~Word(0) : Word(0));
+    }
+
+    //       
+    void ClearTail() noexcept {
+        if (size_ % kBitsPerWord != 0)
+            words_[size_ / kBitsPerWord] &= BitMask(size_) - 1;
+    }
+
+    size_t FindFrom(size_t index) const noexcept {
+        if (index >= size_)
+            return kNotFound;
+        size_t word_index = index / kBitsPerWord;
+        Word word = words_[word_index] & (~Word(0) << (index % kBitsPerWord));
+        const size_t words = WordCount(size_);
+        while (word == 0) {
+            if (++word_index == words)
+                return kNotFound;
+            word = words_[word_index];
+        }
+        return word_index * kBitsPerWord + CountTrailingZeros(word);
+    }
+
+    //  count <= 64 ,    index;       
+    Word ReadBits(size_t index, size_t count) const noexcept {
+        const size_t word = index / kBitsPerWord;
+        const size_t shift = index % kBitsPerWord;
+        Word bits = words_[word] >> shift;
+        if (shift != 0 && shift + count > kBitsPerWord)
+            bits |= words_[word + 1] << (kBitsPerWord - shift);
+        return bits & LowMask(count);
+    }
+
+    //  count <= 64   bits,    index
+    void WriteBits(size_t index, size_t count, Word bits) noexcept {
+        const size_t word = index / kBitsPerWord;
+        const size_t shift = index % kBitsPerWord;
+        const Word mask = LowMask(count);
+        bits &= mask;
+        words_[word] = (words_[word] & ~(mask << shift)) | (bits << shift);
+        if (shift != 0 && shift + count > kBitsPerWord) {
+            const size_t high = kBitsPerWord - shift;
+            words_[word + 1] = (words_[word + 1] & ~(mask >> high)) | (bits >> high);
+        }
+    }
+
+    //  count    from   to   .
+    //   :    ,      
+    void MoveBits(size_t from, size_t to, size_t count) noexcept {
+        if (to < from) {
+            for (size_t done = 0; done < count; done += kBitsPerWord) {
+                const size_t chunk = std::min(kBitsPerWord, count - done);
+                WriteBits(to + done, chunk, ReadBits(from + done, chunk));
+            }
+        }
+        else if (to > from) {
+            for (size_t left = count; left > 0;) {
+                const size_t chunk = std::min(kBitsPerWord, left);
+                left -= chunk;
+                WriteBits(to + left, chunk, ReadBits(from + left, chunk));
+            }
+        }
+    }
+
+    //  count  source,   from,   to  
+    void CopyBits(const SimpleVector& source, size_t from, size_t count, size_t to) noexcept {
+        for (size_t done = 0; done < count; done += kBitsPerWord) {
+            const size_t chunk = std::min(kBitsPerWord, count - done);
+            WriteBits(to + done, chunk, source.ReadBits(from + done, chunk));
+        }
+    }
+
+    //  count   index,  .      
+    void OpenGap(size_t index, size_t count) {
+        assert(index <= size_);
+        if (count == 0)
+            return;
+        if (size_ + count > GetCapacity())
+            Reserve(NextCapacity(size_ + count));
+        const size_t old_size = size_;
+        size_ += count;
+        MoveBits(index, index + count, old_size - index);
+        //      ,   
+        ClearTail();
+    }
+
+    template <typename Operation>
+    SimpleVector& ApplyWords(const SimpleVector& other, Operation operation) {
+        if (size_ != other.size_)
+            throw std::invalid_argument("Bit vectors have different sizes");
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            words_[i] = operation(words_[i], other.words_[i]);
+        }
+        return *this;
+    }
+
+    size_t size_ = 0;
+    ArrayPtr<Word, WordAlloc> words_;
+};
+
+template <typename Alloc, typename Growth>
+SimpleVector<bool, Alloc, Growth> operator&(SimpleVector<bool, Alloc, Growth> lhs, const SimpleVector<bool, Alloc, Growth>& rhs) {
+    return lhs &= rhs;
+}
+
+template <typename Alloc, typename Growth>
+SimpleVector<bool, Alloc, Growth> operator|(SimpleVector<bool, Alloc, Growth> lhs, const SimpleVector<bool, Alloc, Growth>& rhs) {
+    return lhs |= rhs;
+}
+
+template <typename Alloc, typename Growth>
+SimpleVector<bool, Alloc, Growth> operator^(SimpleVector<bool, Alloc, Growth> lhs, const SimpleVector<bool, Alloc, Growth>& rhs) {
+    return lhs ^= rhs;
+}
+
+template <typename Alloc, typename Growth>
+bool operator==(const SimpleVector<bool, Alloc, Growth>& lhs, const SimpleVector<bool, Alloc, Growth>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && EqualElements(lhs.GetWords(), rhs.GetWords(), lhs.GetWordCount());
+}
+
+template <typename Alloc, typename Growth>
+bool operator!=(const SimpleVector<bool, Alloc, Growth>& lhs, const SimpleVector<bool, Alloc, Growth>& rhs) {
+    return !(lhs == rhs);
+}
+
+//    :        
+template <typename Alloc, typename Growth>
+bool operator<(const SimpleVector<bool, Alloc, Growth>& lhs, const SimpleVector<bool, Alloc, Growth>& rhs) {
+    const size_t common = std::min(lhs.GetSize(), rhs.GetSize());
+    const size_t words = (common + 63) / 64;
+    for (size_t i = 0; i < words; ++i) {
+        uint64_t diff = lhs.GetWords()[i] ^ rhs.GetWords()[i];
+        if (i + 1 == words && common % 64 != 0)
+            diff &= (uint64_t(1) << (common % 64)) - 1;
+        if (diff != 0)
+            return ((rhs.GetWords()[i] >> CountTrailingZeros(diff)) & 1) != 0;
+    }
+    return lhs.GetSize() < rhs.GetSize();
+}
+
+template <typename Alloc, typename Growth>
+bool operator<=(const SimpleVector<bool, Alloc, Growth>& lhs, const SimpleVector<bool, Alloc, Growth>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Alloc, typename Growth>
+bool operator>(const SimpleVector<bool, Alloc, Growth>& lhs, const SimpleVector<bool, Alloc, Growth>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Alloc, typename Growth>
+bool operator>=(const SimpleVector<bool, Alloc, Growth>& lhs, const SimpleVector<bool, Alloc, Growth>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+//      SimpleVector: ,   .
+//   threshold     ,   
+//     threshold,    . threads == 0  std::thread::hardware_concurrency()
+struct Parallel {
+    size_t threshold = size_t(1) << 16;
+    unsigned threads = 0;
+};
+
+//  ,   policy  count 
+inline size_t ParallelChunkCount(const Parallel& policy, size_t count) noexcept {
+    const size_t threshold = std::max<size_t>(policy.threshold, 1);
+    if (count < threshold * 2)
+        return 1;
+    size_t threads = policy.threads != 0 ? policy.threads : std::thread::hardware_concurrency();
+    return std::clamp<size_t>(count / threshold, 1, std::max<size_t>(threads, 1));
+}
+
+//  func(index, first, last)    [first, last)  [0, count).
+//      ,    .
+//          
+template <typename Func>
+void ParallelForChunks(size_t chunks, size_t count, Func func) {
+    if (chunks <= 1) {
+        func(size_t(0), size_t(0), count);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(chunks);
+    auto run = [&](size_t index) {
+        const size_t first = count * index / chunks;
+        const size_t last = count * (index + 1) / chunks;
+        try {
+            func(index, first, last);
+        }
+        catch (...) {
+            errors[index] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    try {
+        for (size_t i = 1; i < chunks; ++i) {
+            workers.emplace_back(run, i);
+        }
+    }
+    catch (...) {
+        //   :    
+        for (size_t i = workers.size() + 1; i < chunks; ++i) {
+            run(i);
+        }
+    }
+    run(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+//    count   lhs[i]  rhs[i].
+//             
+template <typename Type>
+bool ParallelEqualRanges(const Parallel& policy, const Type* lhs, const Type* rhs, size_t count) {
+    //  ,    ,     
+    constexpr size_t kBlock = 4096;
+    std::atomic<bool> mismatch{ false };
+    ParallelForChunks(ParallelChunkCount(policy, count), count, [&](size_t, size_t first, size_t last) {
+        while (first < last && !mismatch.load(std::memory_order_relaxed)) {
+            const size_t block_last = std::min(last, first + kBlock);
+            if (!std::equal(lhs + first, lhs + block_last, rhs + first)) {
+                mismatch.store(true, std::memory_order_relaxed);
+                return;
+            }
+            first = block_last;
+        }
+    });
+    return !mismatch.load(std::memory_order_relaxed);
+}
+
+//        count   count,   .
+//      ,        
+template <typename Type>
+size_t ParallelMismatchIndex(const Parallel& policy, const Type* lhs, const Type* rhs, size_t count) {
+    const size_t chunks = ParallelChunkCount(policy, count);
+    std::vector<size_t> found(chunks, count);
+    ParallelForChunks(chunks, count, [&](size_t index, size_t first, size_t last) {
+        const size_t at = std::mismatch(lhs + first, lhs + last, rhs + first).first - lhs;
+        if (at != last)
+            found[index] = at;
+    });
+    for (size_t at : found) {
+        if (at != count)
+            return at;
+    }
+    return count;
+}
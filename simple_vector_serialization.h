@@ -0,0 +1,247 @@
+#pragma once
+
+#include "simple_vector.h"
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+//   SimpleVector   :
+//  SerializedHeader,         .
+//      sizeof(SerializedHeader),  32,
+//           SerializedView.
+//        std::runtime_error
+
+inline constexpr uint32_t kSerializedMagic = 0x56535631u; // "1VSV"
+inline constexpr uint32_t kSerializedVersion = 1;
+
+struct SerializedHeader {
+    uint32_t magic = kSerializedMagic;
+    uint32_t version = kSerializedVersion;
+    //    
+    uint64_t element_size = 0;
+    //  
+    uint64_t count = 0;
+    // SerializationChecksum   
+    uint64_t checksum = 0;
+};
+static_assert(sizeof(SerializedHeader) == 32);
+
+//   FNV-1a,     8    
+inline uint64_t SerializationChecksum(const void* data, size_t size) noexcept {
+    constexpr uint64_t kPrime = 1099511628211ull;
+    uint64_t hash = 14695981039346656037ull;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * kPrime;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * kPrime;
+    }
+    return hash;
+}
+
+template <typename Type>
+SerializedHeader MakeSerializedHeader(const Type* data, size_t count) noexcept {
+    static_assert(std::is_trivially_copyable_v<Type>, "Only trivially copyable types can be serialized");
+    SerializedHeader header;
+    header.element_size = sizeof(Type);
+    header.count = count;
+    header.checksum = SerializationChecksum(data, count * sizeof(Type));
+    return header;
+}
+
+//        size   
+template <typename Type>
+SerializedHeader ParseSerializedHeader(const void* data, size_t size) {
+    static_assert(std::is_trivially_copyable_v<Type>, "Only trivially copyable types can be serialized");
+    SerializedHeader header;
+    if (size < sizeof(header))
+        throw std::runtime_error("Serialized vector is truncated");
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != kSerializedMagic || header.version != kSerializedVersion)
+        throw std::runtime_error("Data is not a serialized vector");
+    if (header.element_size != sizeof(Type))
+        throw std::runtime_error("Serialized element size does not match");
+    if (header.count > (size - sizeof(header)) / sizeof(Type))
+        throw std::runtime_error("Serialized vector is truncated");
+    return header;
+}
+
+//     v  
+template <typename Type, typename Alloc, typename Growth>
+SimpleVector<std::byte> Serialize(const SimpleVector<Type, Alloc, Growth>& v) {
+    const SerializedHeader header = MakeSerializedHeader(v.begin(), v.GetSize());
+    const size_t payload = v.GetSize() * sizeof(Type);
+    SimpleVector<std::byte> bytes(Reserve(sizeof(header) + payload));
+    const std::byte* header_bytes = reinterpret_cast<const std::byte*>(&header);
+    bytes.Append(header_bytes, header_bytes + sizeof(header));
+    const std::byte* payload_bytes = reinterpret_cast<const std::byte*>(v.begin());
+    bytes.Append(payload_bytes, payload_bytes + payload);
+    return bytes;
+}
+
+//  v  :      
+template <typename Type, typename Alloc, typename Growth>
+void WriteBinary(std::ostream& out, const SimpleVector<Type, Alloc, Growth>& v) {
+    const SerializedHeader header = MakeSerializedHeader(v.begin(), v.GetSize());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!v.IsEmpty())
+        out.write(reinterpret_cast<const char*>(v.begin()), static_cast<std::streamsize>(v.GetSize() * sizeof(Type)));
+    if (!out)
+        throw std::runtime_error("Failed to write serialized vector");
+}
+
+//  ,  ReadBinary    
+inline constexpr size_t kSerializedReadChunk = size_t(1) << 20;
+
+//  ,  WriteBinary.      :
+//     max_count  (    )  .
+//     ,          
+//    .        kSerializedReadChunk 
+//   ,        .    
+template <typename Type, typename Alloc = std::allocator<Type>>
+SimpleVector<Type, Alloc> ReadBinary(std::istream& in, const Alloc& alloc = Alloc(),
+    size_t max_count = static_cast<size_t>(-1) / sizeof(Type)) {
+    SerializedHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        throw std::runtime_error("Serialized vector is truncated");
+    if (header.magic != kSerializedMagic || header.version != kSerializedVersion)
+        throw std::runtime_error("Data is not a serialized vector");
+    if (header.element_size != sizeof(Type))
+        throw std::runtime_error("Serialized element size does not match");
+    if (header.count > std::min<uint64_t>(max_count, static_cast<size_t>(-1) / sizeof(Type)))
+        throw std::runtime_error("Serialized vector is too large");
+    const size_t count = static_cast<size_t>(header.count);
+
+    bool bounded = false;
+    const std::istream::pos_type position = in.tellg();
+    if (position != std::istream::pos_type(-1)) {
+        in.seekg(0, std::ios_base::end);
+        const std::istream::pos_type last = in.tellg();
+        in.seekg(position);
+        if (last != std::istream::pos_type(-1)) {
+            if (count > static_cast<size_t>(last - position) / sizeof(Type))
+                throw std::runtime_error("Serialized vector is truncated");
+            bounded = true;
+        }
+    }
+
+    using Vector = SimpleVector<Type, Alloc>;
+    Vector result(alloc);
+    if (bounded) {
+        result.Reserve(count);
+        typename Vector::BackInserter writer(result, count);
+        char* target = reinterpret_cast<char*>(writer.Claim(count));
+        if (!in.read(target, static_cast<std::streamsize>(count * sizeof(Type))))
+            throw std::runtime_error("Serialized vector is truncated");
+    }
+    const size_t chunk = std::max<size_t>(kSerializedReadChunk / sizeof(Type), 1);
+    while (result.GetSize() < count) {
+        const size_t step = std::min(chunk, count - result.GetSize());
+        //   ,     
+        if (result.GetCapacity() - result.GetSize() < step)
+            result.Reserve(std::min(count, std::max(result.GetSize() + step, result.GetCapacity() * 2)));
+        typename Vector::BackInserter writer(result, step);
+        char* target = reinterpret_cast<char*>(writer.Claim(step));
+        if (!in.read(target, static_cast<std::streamsize>(step * sizeof(Type))))
+            throw std::runtime_error("Serialized vector is truncated");
+    }
+    if (SerializationChecksum(result.begin(), count * sizeof(Type)) != header.checksum)
+        throw std::runtime_error("Serialized vector checksum mismatch");
+    return result;
+}
+
+//          ,  .
+//     ,        Type
+template <typename Type>
+class SerializedView {
+public:
+    using ConstIterator = const Type*;
+
+    //  ,   ( verify_checksum)  
+    SerializedView(const void* data, size_t size, bool verify_checksum = true) {
+        const SerializedHeader header = ParseSerializedHeader<Type>(data, size);
+        const void* payload = static_cast<const unsigned char*>(data) + sizeof(header);
+        if (reinterpret_cast<uintptr_t>(payload) % alignof(Type) != 0)
+            throw std::runtime_error("Serialized payload is not aligned for the element type");
+        if (verify_checksum && SerializationChecksum(payload, header.count * sizeof(Type)) != header.checksum)
+            throw std::runtime_error("Serialized vector checksum mismatch");
+        data_ = static_cast<const Type*>(payload);
+        size_ = static_cast<size_t>(header.count);
+    }
+
+    //   
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    //   std::out_of_range,  index >= size
+    const Type& At(size_t index) const {
+        if (index >= size_)
+            throw std::out_of_range("Index out of range");
+        return data_[index];
+    }
+
+    ConstIterator begin() const noexcept {
+        return data_;
+    }
+
+    ConstIterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    //        
+    SimpleVector<Type> ToVector() const {
+        return SimpleVector<Type>(begin(), end());
+    }
+
+private:
+    const Type* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+//     :      memcpy
+template <typename Type>
+SimpleVector<Type> Deserialize(const void* data, size_t size) {
+    const SerializedHeader header = ParseSerializedHeader<Type>(data, size);
+    const unsigned char* payload = static_cast<const unsigned char*>(data) + sizeof(header);
+    const size_t payload_size = static_cast<size_t>(header.count) * sizeof(Type);
+    if (SerializationChecksum(payload, payload_size) != header.checksum)
+        throw std::runtime_error("Serialized vector checksum mismatch");
+
+    SimpleVector<Type> result(Reserve(static_cast<size_t>(header.count)));
+    if (reinterpret_cast<uintptr_t>(payload) % alignof(Type) == 0) {
+        const Type* first = reinterpret_cast<const Type*>(payload);
+        result.Append(first, first + header.count);
+    }
+    else {
+        result.Resize(static_cast<size_t>(header.count));
+        if (payload_size > 0)
+            std::memcpy(static_cast<void*>(result.begin()), payload, payload_size);
+    }
+    return result;
+}
\ No newline at end of file
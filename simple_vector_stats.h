@@ -0,0 +1,184 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "constexpr_support.h"
+
+//     SimpleVector.   :
+// #define SIMPLE_VECTOR_ENABLE_STATS 1 ( -DSIMPLE_VECTOR_ENABLE_STATS=1)   simple_vector.h.
+//               
+#ifndef SIMPLE_VECTOR_ENABLE_STATS
+#define SIMPLE_VECTOR_ENABLE_STATS 0
+#endif
+
+inline constexpr bool kSimpleVectorStatsEnabled = SIMPLE_VECTOR_ENABLE_STATS != 0;
+
+struct SimpleVectorStats {
+    //   
+    size_t allocations = 0;
+    //      
+    size_t bytes_allocated = 0;
+    //        
+    size_t regrowths = 0;
+    // ,        
+    size_t element_moves = 0;
+    // ,  
+    size_t element_copies = 0;
+    //    
+    size_t peak_capacity = 0;
+    //  PooledAllocator,        (. allocators.h).
+    //   ,    ,      
+    size_t pool_hits = 0;
+    size_t pool_misses = 0;
+};
+
+//      
+class SimpleVectorStatsRegistry {
+public:
+    static SimpleVectorStats Snapshot() noexcept {
+        Counters& counters = Get();
+        SimpleVectorStats stats;
+        stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+        stats.bytes_allocated = counters.bytes_allocated.load(std::memory_order_relaxed);
+        stats.regrowths = counters.regrowths.load(std::memory_order_relaxed);
+        stats.element_moves = counters.element_moves.load(std::memory_order_relaxed);
+        stats.element_copies = counters.element_copies.load(std::memory_order_relaxed);
+        stats.peak_capacity = counters.peak_capacity.load(std::memory_order_relaxed);
+        stats.pool_hits = counters.pool_hits.load(std::memory_order_relaxed);
+        stats.pool_misses = counters.pool_misses.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    static void Reset() noexcept {
+        Counters& counters = Get();
+        counters.allocations.store(0, std::memory_order_relaxed);
+        counters.bytes_allocated.store(0, std::memory_order_relaxed);
+        counters.regrowths.store(0, std::memory_order_relaxed);
+        counters.element_moves.store(0, std::memory_order_relaxed);
+        counters.element_copies.store(0, std::memory_order_relaxed);
+        counters.peak_capacity.store(0, std::memory_order_relaxed);
+        counters.pool_hits.store(0, std::memory_order_relaxed);
+        counters.pool_misses.store(0, std::memory_order_relaxed);
+    }
+
+    static void OnAllocate(size_t capacity, size_t bytes) noexcept {
+        Counters& counters = Get();
+        counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+        size_t peak = counters.peak_capacity.load(std::memory_order_relaxed);
+        while (peak < capacity && !counters.peak_capacity.compare_exchange_weak(peak, capacity, std::memory_order_relaxed)) {
+        }
+    }
+
+    static void OnRegrowth() noexcept {
+        Get().regrowths.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void OnMoves(size_t count) noexcept {
+        Get().element_moves.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void OnCopies(size_t count) noexcept {
+        Get().element_copies.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void OnPoolHit() noexcept {
+        Get().pool_hits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void OnPoolMiss() noexcept {
+        Get().pool_misses.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    struct Counters {
+        std::atomic<size_t> allocations{ 0 };
+        std::atomic<size_t> bytes_allocated{ 0 };
+        std::atomic<size_t> regrowths{ 0 };
+        std::atomic<size_t> element_moves{ 0 };
+        std::atomic<size_t> element_copies{ 0 };
+        std::atomic<size_t> peak_capacity{ 0 };
+        std::atomic<size_t> pool_hits{ 0 };
+        std::atomic<size_t> pool_misses{ 0 };
+    };
+
+    static Counters& Get() noexcept {
+        static Counters counters;
+        return counters;
+    }
+};
+
+//   SimpleVector,        
+// (    ,    ).
+//   ,           
+template <bool Enabled = kSimpleVectorStatsEnabled>
+class SimpleVectorStatsRecorder {
+public:
+    //    
+    SIMPLE_VECTOR_CONSTEXPR SimpleVectorStats GetStats() const noexcept {
+        return stats_;
+    }
+
+protected:
+    SimpleVectorStatsRecorder() = default;
+
+    //       
+    SIMPLE_VECTOR_CONSTEXPR SimpleVectorStatsRecorder(const SimpleVectorStatsRecorder&) noexcept {
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR SimpleVectorStatsRecorder& operator=(const SimpleVectorStatsRecorder&) noexcept {
+        return *this;
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void OnAllocate(size_t capacity, size_t bytes) noexcept {
+        ++stats_.allocations;
+        stats_.bytes_allocated += bytes;
+        if (capacity > stats_.peak_capacity)
+            stats_.peak_capacity = capacity;
+        if (!IsConstantEvaluated())
+            SimpleVectorStatsRegistry::OnAllocate(capacity, bytes);
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void OnRegrowth() noexcept {
+        ++stats_.regrowths;
+        if (!IsConstantEvaluated())
+            SimpleVectorStatsRegistry::OnRegrowth();
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void OnMoves(size_t count) noexcept {
+        stats_.element_moves += count;
+        if (!IsConstantEvaluated())
+            SimpleVectorStatsRegistry::OnMoves(count);
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void OnCopies(size_t count) noexcept {
+        stats_.element_copies += count;
+        if (!IsConstantEvaluated())
+            SimpleVectorStatsRegistry::OnCopies(count);
+    }
+
+private:
+    SimpleVectorStats stats_;
+};
+
+template <>
+class SimpleVectorStatsRecorder<false> {
+public:
+    SIMPLE_VECTOR_CONSTEXPR SimpleVectorStats GetStats() const noexcept {
+        return {};
+    }
+
+protected:
+    SIMPLE_VECTOR_CONSTEXPR void OnAllocate(size_t, size_t) noexcept {
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void OnRegrowth() noexcept {
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void OnMoves(size_t) noexcept {
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void OnCopies(size_t) noexcept {
+    }
+};
\ No newline at end of file
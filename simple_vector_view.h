@@ -0,0 +1,160 @@
+#pragma once
+
+#include "simple_vector.h"
+
+//       :   .
+// SimpleVectorView<const T>  , SimpleVectorView<T>   .
+//   SimpleVector, SmallSimpleVector     begin(),  ,
+//  GetSize().     ,       
+template <typename Type>
+class SimpleVectorView;
+
+//      .     SimpleVectorView<T>  SimpleVectorView<const T>,
+//         ,   
+//  SimpleVectorView<const T> :  ,         
+template <typename ValueType>
+class SimpleVectorViewComparisons {
+    using View = SimpleVectorView<const ValueType>;
+
+    friend bool operator==(View lhs, View rhs) {
+        if (lhs.GetSize() != rhs.GetSize())
+            return false;
+        return EqualElements(lhs.cbegin(), rhs.cbegin(), lhs.GetSize());
+    }
+
+    friend bool operator!=(View lhs, View rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(View lhs, View rhs) {
+        return CompareElements(lhs.cbegin(), lhs.GetSize(), rhs.cbegin(), rhs.GetSize()) < 0;
+    }
+
+    friend bool operator<=(View lhs, View rhs) {
+        return CompareElements(lhs.cbegin(), lhs.GetSize(), rhs.cbegin(), rhs.GetSize()) <= 0;
+    }
+
+    friend bool operator>(View lhs, View rhs) {
+        return CompareElements(lhs.cbegin(), lhs.GetSize(), rhs.cbegin(), rhs.GetSize()) > 0;
+    }
+
+    friend bool operator>=(View lhs, View rhs) {
+        return CompareElements(lhs.cbegin(), lhs.GetSize(), rhs.cbegin(), rhs.GetSize()) >= 0;
+    }
+};
+
+template <typename Type>
+class SimpleVectorView : public SimpleVectorViewComparisons<std::remove_const_t<Type>> {
+    using ValueType = std::remove_const_t<Type>;
+
+    template <typename Container>
+    static auto ContainerData(Container& container) noexcept {
+        if constexpr (std::is_const_v<Type>)
+            return std::as_const(container).begin();
+        else
+            return container.begin();
+    }
+
+    template <typename Container>
+    using RequireContainer = std::enable_if_t<
+        std::is_convertible_v<decltype(ContainerData(std::declval<Container&>())), Type*>
+        && std::is_convertible_v<decltype(std::declval<const Container&>().GetSize()), size_t>
+        && !std::is_same_v<std::remove_const_t<Container>, SimpleVectorView>>;
+
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    //  count  Subview,  "  "
+    static constexpr size_t kUntilEnd = static_cast<size_t>(-1);
+
+    SimpleVectorView() noexcept = default;
+
+    SimpleVectorView(Type* data, size_t size) noexcept
+        :data_(data), size_(size)
+    {
+    }
+
+    //      last,  SimpleVectorView(data, 0)   ,    
+    template <typename Last, typename = std::enable_if_t<std::is_convertible_v<Last, Type*> && !std::is_integral_v<Last>>>
+    SimpleVectorView(Type* first, Last last) noexcept
+        :data_(first), size_(static_cast<Type*>(last) - first)
+    {
+    }
+
+    //     
+    template <typename Container, typename = RequireContainer<Container>>
+    SimpleVectorView(Container& container) noexcept
+        :data_(ContainerData(container)), size_(std::as_const(container).GetSize())
+    {
+    }
+
+    //      
+    template <typename Other, typename = std::enable_if_t<std::is_convertible_v<Other*, Type*>
+        && std::is_same_v<std::remove_const_t<Other>, ValueType>>>
+    SimpleVectorView(SimpleVectorView<Other> other) noexcept
+        :data_(other.Data()), size_(other.GetSize())
+    {
+    }
+
+    //   
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    //     
+    Type* Data() const noexcept {
+        return data_;
+    }
+
+    Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    //       index.
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) const {
+        if (index >= size_)
+            throw std::out_of_range("Index out of range");
+        return data_[index];
+    }
+
+    //    count    offset; count    .
+    //   std::out_of_range,  offset > size
+    SimpleVectorView Subview(size_t offset, size_t count = kUntilEnd) const {
+        if (offset > size_)
+            throw std::out_of_range("Subview offset out of range");
+        return SimpleVectorView(data_ + offset, std::min(count, size_ - offset));
+    }
+
+    //     
+    SimpleVector<ValueType> ToVector() const {
+        return SimpleVector<ValueType>(begin(), end());
+    }
+
+    Iterator begin() const noexcept {
+        return data_;
+    }
+
+    Iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return data_;
+    }
+
+    ConstIterator cend() const noexcept {
+        return data_ + size_;
+    }
+
+private:
+    Type* data_ = nullptr;
+    size_t size_ = 0;
+};
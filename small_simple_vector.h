@@ -0,0 +1,425 @@
+#pragma once
+
+#include "simple_vector.h"
+
+//     ,   SimpleVector,    N    .
+//   ( ArrayPtr)  ,       .
+// Growth       (. growth_policy.h)
+template <typename Type, size_t N, typename Alloc = std::allocator<Type>, typename Growth = GrowthDouble>
+class SmallSimpleVector {
+    static_assert(N > 0, "Inline capacity must be positive");
+
+    using AllocTraits = typename std::allocator_traits<Alloc>::template rebind_traits<Type>;
+
+public:
+    using AllocatorType = typename AllocTraits::allocator_type;
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    SmallSimpleVector() noexcept(noexcept(AllocatorType())) {
+    }
+
+    //   ,      alloc     
+    explicit SmallSimpleVector(const AllocatorType& alloc) noexcept
+        :heap_(alloc)
+    {
+    }
+
+    //    size ,    
+    explicit SmallSimpleVector(size_t size, const AllocatorType& alloc = AllocatorType())
+        :heap_(alloc)
+    {
+        Reserve(size);
+        ConstructElements(GetAlloc(), data_, size);
+        size_ = size;
+    }
+
+    //    size ,   value
+    SmallSimpleVector(size_t size, const Type& value, const AllocatorType& alloc = AllocatorType())
+        :heap_(alloc)
+    {
+        Reserve(size);
+        ConstructElements(GetAlloc(), data_, size, value);
+        size_ = size;
+    }
+
+    //    std::initializer_list
+    SmallSimpleVector(std::initializer_list<Type> init, const AllocatorType& alloc = AllocatorType())
+        :heap_(alloc)
+    {
+        Reserve(init.size());
+        CopyElements(GetAlloc(), init.begin(), init.end(), data_);
+        size_ = init.size();
+    }
+
+    SmallSimpleVector(ReserveProxyObj const& obj, const AllocatorType& alloc = AllocatorType())
+        :heap_(alloc)
+    {
+        Reserve(obj.size_);
+    }
+
+    SmallSimpleVector(const SmallSimpleVector& other)
+        :heap_(AllocTraits::select_on_container_copy_construction(other.heap_.GetAllocator()))
+    {
+        Reserve(other.size_);
+        CopyElements(GetAlloc(), other.begin(), other.end(), data_);
+        size_ = other.size_;
+    }
+
+    //     ,      
+    SmallSimpleVector(SmallSimpleVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>)
+        :heap_(other.heap_.GetAllocator())
+    {
+        if (!other.IsInline()) {
+            heap_ = std::move(other.heap_);
+            data_ = heap_.Get();
+            capacity_ = other.capacity_;
+            size_ = std::exchange(other.size_, 0);
+            other.ResetToInline();
+            return;
+        }
+        MoveElements(GetAlloc(), other.data_, other.size_, data_);
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    SmallSimpleVector& operator=(const SmallSimpleVector& rhs) {
+        if (this == &rhs)
+            return *this;
+
+        SmallSimpleVector temp(rhs);
+        *this = std::move(temp);
+        return *this;
+    }
+
+    SmallSimpleVector& operator=(SmallSimpleVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>
+        && (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)) {
+        if (this == &other)
+            return *this;
+
+        Clear();
+        if (!other.IsInline() && CanStealFrom(other)) {
+            heap_ = std::move(other.heap_);
+            data_ = heap_.Get();
+            capacity_ = other.capacity_;
+            size_ = std::exchange(other.size_, 0);
+            other.ResetToInline();
+            return *this;
+        }
+        Reserve(other.size_);
+        MoveElements(GetAlloc(), other.data_, other.size_, data_);
+        size_ = std::exchange(other.size_, 0);
+        return *this;
+    }
+
+    ~SmallSimpleVector() {
+        DestroyElements(GetAlloc(), begin(), end());
+    }
+
+    //   ,     
+    AllocatorType GetAllocator() const noexcept {
+        return heap_.GetAllocator();
+    }
+
+    // ,      
+    bool IsInline() const noexcept {
+        return data_ == InlineData();
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    //   ,   N
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return !size_;
+    }
+
+    //       index
+    Type& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    //        index
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    //       index
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= size_)
+            throw std::out_of_range("Element's index is incorrect (bigger than size)");
+        return data_[index];
+    }
+
+    //        index
+    //   std::out_of_range,  index >= size
+    const Type& At(size_t index) const {
+        if (index >= size_)
+            throw std::out_of_range("Element's index is incorrect (bigger than size)");
+        return data_[index];
+    }
+
+    //   ,    
+    void Clear() noexcept {
+        DestroyElements(GetAlloc(), begin(), end());
+        size_ = 0;
+    }
+
+    //   .
+    //            Type
+    void Resize(size_t new_size) {
+        if (new_size == size_)
+            return;
+        if (new_size < size_) {
+            DestroyElements(GetAlloc(), begin() + new_size, end());
+            size_ = new_size;
+            return;
+        }
+        if (new_size > capacity_)
+            Reserve(NextCapacity(new_size));
+        ConstructElements(GetAlloc(), end(), new_size - size_);
+        size_ = new_size;
+    }
+
+    void PopBack() noexcept {
+        if (size_ == 0u)
+            return;
+        --size_;
+        AllocTraits::destroy(GetAlloc(), end());
+    }
+
+    Iterator Erase(ConstIterator pos) {
+        assert(pos >= begin() && pos < end());
+        auto it = begin() + std::distance(cbegin(), pos);
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            AllocTraits::destroy(GetAlloc(), it);
+            RelocateOverlapping(std::next(it), std::distance(std::next(it), end()), it);
+            --size_;
+        }
+        else {
+            std::move(std::next(it), end(), it);
+            PopBack();
+        }
+        return it;
+    }
+
+    void PushBack(const Type& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(Type&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    //    args       
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        if (size_ == capacity_)
+            return *ReallocateAndEmplace(size_, std::forward<Args>(args)...);
+        AllocTraits::construct(GetAlloc(), end(), std::forward<Args>(args)...);
+        ++size_;
+        return *std::prev(end());
+    }
+
+    //    args   pos
+    template <typename... Args>
+    Iterator Emplace(ConstIterator pos, Args&&... args) {
+        assert(pos >= begin() && pos <= end());
+        const size_t index = std::distance(cbegin(), pos);
+        if (size_ == capacity_)
+            return ReallocateAndEmplace(index, std::forward<Args>(args)...);
+        if (index == size_)
+            return &EmplaceBack(std::forward<Args>(args)...);
+
+        Type value(std::forward<Args>(args)...);
+        Iterator pos2 = begin() + index;
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            RelocateOverlapping(pos2, size_ - index, pos2 + 1);
+            try {
+                AllocTraits::construct(GetAlloc(), pos2, std::move(value));
+            }
+            catch (...) {
+                RelocateOverlapping(pos2 + 1, size_ - index, pos2);
+                throw;
+            }
+        }
+        else {
+            AllocTraits::construct(GetAlloc(), end(), std::move(*std::prev(end())));
+            std::move_backward(pos2, std::prev(end()), end());
+            *pos2 = std::move(value);
+        }
+        ++size_;
+        return pos2;
+    }
+
+    Iterator Insert(ConstIterator pos, const Type& value) {
+        return Emplace(pos, value);
+    }
+
+    Iterator Insert(ConstIterator pos, Type&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    Iterator begin() noexcept {
+        return data_;
+    }
+
+    Iterator end() noexcept {
+        return data_ + size_;
+    }
+
+    ConstIterator begin() const noexcept {
+        return data_;
+    }
+
+    ConstIterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return data_;
+    }
+
+    ConstIterator cend() const noexcept {
+        return data_ + size_;
+    }
+
+    //     ,   ,      
+    void swap(SmallSimpleVector& rhs) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        if (!IsInline() && !rhs.IsInline()) {
+            heap_.swap(rhs.heap_);
+            std::swap(data_, rhs.data_);
+            std::swap(size_, rhs.size_);
+            std::swap(capacity_, rhs.capacity_);
+            return;
+        }
+        SmallSimpleVector temp(std::move(rhs));
+        rhs = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    //      N,   N    
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= capacity_)
+            return;
+        ArrayPtr<Type, AllocatorType> temp(new_capacity, GetAlloc());
+        RelocateElements(GetAlloc(), data_, size_, temp.Get());
+        heap_ = std::move(temp);
+        data_ = heap_.Get();
+        capacity_ = new_capacity;
+    }
+
+private:
+    AllocatorType& GetAlloc() noexcept {
+        return heap_.GetAllocator();
+    }
+
+    size_t NextCapacity(size_t required) const noexcept {
+        return Growth::NextCapacity(capacity_, required, sizeof(Type));
+    }
+
+    Type* InlineData() noexcept {
+        return reinterpret_cast<Type*>(inline_);
+    }
+
+    const Type* InlineData() const noexcept {
+        return reinterpret_cast<const Type*>(inline_);
+    }
+
+    bool CanStealFrom(SmallSimpleVector& other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+            return true;
+        else
+            return GetAlloc() == other.GetAlloc();
+    }
+
+    //        ,     
+    void ResetToInline() noexcept {
+        data_ = InlineData();
+        capacity_ = N;
+    }
+
+    //             ,
+    //  SimpleVector::RelocateAroundGap:   ,    ,
+    //      
+    template <typename... Args>
+    Iterator ReallocateAndEmplace(size_t index, Args&&... args) {
+        const size_t new_capacity = NextCapacity(size_ + 1);
+        ArrayPtr<Type, AllocatorType> temp(new_capacity, GetAlloc());
+        Type* item = temp.Get() + index;
+        AllocTraits::construct(GetAlloc(), item, std::forward<Args>(args)...);
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            RelocateElements(GetAlloc(), data_, index, temp.Get());
+            RelocateElements(GetAlloc(), data_ + index, size_ - index, item + 1);
+        }
+        else {
+            try {
+                CopyElements(GetAlloc(), RelocationIterator(data_), RelocationIterator(data_ + index), temp.Get());
+            }
+            catch (...) {
+                AllocTraits::destroy(GetAlloc(), item);
+                throw;
+            }
+            try {
+                CopyElements(GetAlloc(), RelocationIterator(data_ + index), RelocationIterator(end()), item + 1);
+            }
+            catch (...) {
+                DestroyElements(GetAlloc(), temp.Get(), item + 1);
+                throw;
+            }
+            DestroyElements(GetAlloc(), begin(), end());
+        }
+        heap_ = std::move(temp);
+        data_ = heap_.Get();
+        capacity_ = new_capacity;
+        ++size_;
+        return item;
+    }
+
+    alignas(Type) unsigned char inline_[N * sizeof(Type)];
+    ArrayPtr<Type, AllocatorType> heap_;
+    Type* data_ = InlineData();
+    size_t size_ = 0;
+    size_t capacity_ = N;
+};
+
+template <typename Type, size_t N, typename Alloc, typename Growth>
+inline bool operator==(const SmallSimpleVector<Type, N, Alloc, Growth>& lhs, const SmallSimpleVector<Type, N, Alloc, Growth>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize())
+        return false;
+    return EqualElements(lhs.begin(), rhs.begin(), lhs.GetSize());
+}
+
+template <typename Type, size_t N, typename Alloc, typename Growth>
+inline bool operator!=(const SmallSimpleVector<Type, N, Alloc, Growth>& lhs, const SmallSimpleVector<Type, N, Alloc, Growth>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N, typename Alloc, typename Growth>
+inline bool operator<(const SmallSimpleVector<Type, N, Alloc, Growth>& lhs, const SmallSimpleVector<Type, N, Alloc, Growth>& rhs) {
+    return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) < 0;
+}
+
+template <typename Type, size_t N, typename Alloc, typename Growth>
+inline bool operator<=(const SmallSimpleVector<Type, N, Alloc, Growth>& lhs, const SmallSimpleVector<Type, N, Alloc, Growth>& rhs) {
+    return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) <= 0;
+}
+
+template <typename Type, size_t N, typename Alloc, typename Growth>
+inline bool operator>(const SmallSimpleVector<Type, N, Alloc, Growth>& lhs, const SmallSimpleVector<Type, N, Alloc, Growth>& rhs) {
+    return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) > 0;
+}
+
+template <typename Type, size_t N, typename Alloc, typename Growth>
+inline bool operator>=(const SmallSimpleVector<Type, N, Alloc, Growth>& lhs, const SmallSimpleVector<Type, N, Alloc, Growth>& rhs) {
+    return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) >= 0;
+}
\ No newline at end of file
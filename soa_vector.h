@@ -0,0 +1,320 @@
+#pragma once
+
+#include "simple_vector.h"
+#include "simple_vector_view.h"
+
+#include <tuple>
+
+//  " ":     Fields...    ,
+//     (ArrayPtr)   . ,     ,
+//     ,        .
+// PushBack, Resize  Reserve     SimpleVector,    Column<I>()
+template <typename... Fields>
+class SoaVector {
+    static_assert(sizeof...(Fields) > 0, "SoaVector needs at least one field");
+
+    using Indices = std::index_sequence_for<Fields...>;
+
+public:
+    //     I
+    template <size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    //  
+    static constexpr size_t kFieldCount = sizeof...(Fields);
+
+    SoaVector() = default;
+
+    //  size ,      
+    explicit SoaVector(size_t size) {
+        Resize(size);
+    }
+
+    SoaVector(const SoaVector& other) {
+        Reserve(other.size_);
+        CopyRowsFrom(other, Indices{});
+        size_ = other.size_;
+    }
+
+    SoaVector(SoaVector&& other) noexcept
+        :size_(std::exchange(other.size_, 0)), capacity_(std::exchange(other.capacity_, 0)),
+        columns_(std::move(other.columns_))
+    {
+    }
+
+    SoaVector& operator=(const SoaVector& rhs) {
+        if (this == &rhs)
+            return *this;
+        SoaVector temp(rhs);
+        swap(temp);
+        return *this;
+    }
+
+    SoaVector& operator=(SoaVector&& other) noexcept {
+        if (this == &other)
+            return *this;
+        SoaVector temp(std::move(other));
+        swap(temp);
+        return *this;
+    }
+
+    ~SoaVector() {
+        DestroyRows(0, size_, Indices{});
+    }
+
+    //   
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    //    
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    //      I
+    template <size_t I>
+    SimpleVectorView<FieldType<I>> Column() noexcept {
+        return SimpleVectorView<FieldType<I>>(std::get<I>(columns_).Get(), size_);
+    }
+
+    template <size_t I>
+    SimpleVectorView<const FieldType<I>> Column() const noexcept {
+        return SimpleVectorView<const FieldType<I>>(std::get<I>(columns_).Get(), size_);
+    }
+
+    //   I  index
+    template <size_t I>
+    FieldType<I>& Get(size_t index) noexcept {
+        assert(index < size_);
+        return std::get<I>(columns_)[index];
+    }
+
+    template <size_t I>
+    const FieldType<I>& Get(size_t index) const noexcept {
+        assert(index < size_);
+        return std::get<I>(columns_)[index];
+    }
+
+    //       index
+    std::tuple<Fields&...> Row(size_t index) noexcept {
+        assert(index < size_);
+        return RowAt(index, Indices{});
+    }
+
+    std::tuple<const Fields&...> Row(size_t index) const noexcept {
+        assert(index < size_);
+        return RowAt(index, Indices{});
+    }
+
+    //   std::out_of_range,  index >= size
+    std::tuple<Fields&...> At(size_t index) {
+        if (index >= size_)
+            throw std::out_of_range("Index out of range");
+        return RowAt(index, Indices{});
+    }
+
+    std::tuple<const Fields&...> At(size_t index) const {
+        if (index >= size_)
+            throw std::out_of_range("Index out of range");
+        return RowAt(index, Indices{});
+    }
+
+    //   ,   
+    void Clear() noexcept {
+        DestroyRows(0, size_, Indices{});
+        size_ = 0;
+    }
+
+    //   .       
+    void Resize(size_t new_size) {
+        if (new_size <= size_) {
+            DestroyRows(new_size, size_, Indices{});
+            size_ = new_size;
+            return;
+        }
+        if (new_size > capacity_)
+            Reserve(std::max(capacity_ * 2, new_size));
+        ConstructRows(new_size - size_, Indices{});
+        size_ = new_size;
+    }
+
+    //    new_capacity    
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= capacity_)
+            return;
+        //     ,        
+        std::tuple<ArrayPtr<Fields>...> fresh{ ArrayPtr<Fields>(new_capacity)... };
+        RelocateColumns(fresh, Indices{});
+        columns_.swap(fresh);
+        capacity_ = new_capacity;
+    }
+
+    //      fields
+    void PushBack(Fields... fields) {
+        if (size_ == capacity_)
+            Reserve(capacity_ == 0u ? 1 : capacity_ * 2);
+        EmplaceRow(Indices{}, std::move(fields)...);
+        ++size_;
+    }
+
+    // ""  .     
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        DestroyRows(size_ - 1, size_, Indices{});
+        --size_;
+    }
+
+    //     
+    void swap(SoaVector& other) noexcept {
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        columns_.swap(other.columns_);
+    }
+
+private:
+    template <size_t... I>
+    auto RowAt(size_t index, std::index_sequence<I...>) noexcept {
+        return std::tuple<Fields&...>(std::get<I>(columns_)[index]...);
+    }
+
+    template <size_t... I>
+    auto RowAt(size_t index, std::index_sequence<I...>) const noexcept {
+        return std::tuple<const Fields&...>(std::get<I>(columns_)[index]...);
+    }
+
+    template <size_t... I>
+    void DestroyRows(size_t first, size_t last, std::index_sequence<I...>) noexcept {
+        (DestroyColumn<I>(first, last), ...);
+    }
+
+    template <size_t I>
+    void DestroyColumn(size_t first, size_t last) noexcept {
+        std::allocator<FieldType<I>> alloc;
+        DestroyElements(alloc, std::get<I>(columns_).Get() + first, std::get<I>(columns_).Get() + last);
+    }
+
+    //  count   .    ,
+    //       
+    template <size_t... I>
+    void ConstructRows(size_t count, std::index_sequence<I...>) {
+        size_t done = 0;
+        try {
+            ((ConstructColumn<I>(count), ++done), ...);
+        }
+        catch (...) {
+            DestroyFirstColumns(done, size_, size_ + count, Indices{});
+            throw;
+        }
+    }
+
+    template <size_t I>
+    void ConstructColumn(size_t count) {
+        std::allocator<FieldType<I>> alloc;
+        ConstructElements(alloc, std::get<I>(columns_).Get() + size_, count);
+    }
+
+    template <size_t... I>
+    void EmplaceRow(std::index_sequence<I...>, Fields&&... fields) {
+        size_t done = 0;
+        try {
+            ((EmplaceColumn<I>(std::move(fields)), ++done), ...);
+        }
+        catch (...) {
+            DestroyFirstColumns(done, size_, size_ + 1, Indices{});
+            throw;
+        }
+    }
+
+    template <size_t I>
+    void EmplaceColumn(FieldType<I>&& field) {
+        std::allocator<FieldType<I>> alloc;
+        std::allocator_traits<std::allocator<FieldType<I>>>::construct(alloc, std::get<I>(columns_).Get() + size_, std::move(field));
+    }
+
+    //   [first, last)   count 
+    template <size_t... I>
+    void DestroyFirstColumns(size_t count, size_t first, size_t last, std::index_sequence<I...>) noexcept {
+        ((I < count ? DestroyColumn<I>(first, last) : void()), ...);
+    }
+
+    //     fresh   ,  SimpleVector::RelocateAroundGap:
+    //   ,     ,     
+    //  ,      .
+    //    SimpleVector,          
+    template <size_t... I>
+    void RelocateColumns(std::tuple<ArrayPtr<Fields>...>& fresh, std::index_sequence<I...>) {
+        size_t done = 0;
+        try {
+            ((TransferColumn<I>(std::get<I>(fresh)), ++done), ...);
+        }
+        catch (...) {
+            ((I < done ? DiscardColumn<I>(std::get<I>(fresh)) : void()), ...);
+            throw;
+        }
+        (FinishColumn<I>(std::get<I>(fresh)), ...);
+    }
+
+    //    I  
+    template <size_t I>
+    static constexpr bool kNothrowRelocation = IsTriviallyRelocatableV<FieldType<I>>
+        || std::is_nothrow_move_constructible_v<FieldType<I>>;
+
+    //  ,    ,    
+    template <size_t I>
+    void TransferColumn(ArrayPtr<FieldType<I>>& fresh) {
+        if constexpr (!kNothrowRelocation<I>) {
+            std::allocator<FieldType<I>> alloc;
+            FieldType<I>* source = std::get<I>(columns_).Get();
+            CopyElements(alloc, RelocationIterator(source), RelocationIterator(source + size_), fresh.Get());
+        }
+    }
+
+    template <size_t I>
+    void DiscardColumn(ArrayPtr<FieldType<I>>& fresh) noexcept {
+        if constexpr (!kNothrowRelocation<I>) {
+            std::allocator<FieldType<I>> alloc;
+            DestroyElements(alloc, fresh.Get(), fresh.Get() + size_);
+        }
+    }
+
+    //           
+    template <size_t I>
+    void FinishColumn(ArrayPtr<FieldType<I>>& fresh) noexcept {
+        if constexpr (kNothrowRelocation<I>) {
+            std::allocator<FieldType<I>> alloc;
+            RelocateElements(alloc, std::get<I>(columns_).Get(), size_, fresh.Get());
+        }
+        else {
+            DestroyColumn<I>(0, size_);
+        }
+    }
+
+    template <size_t... I>
+    void CopyRowsFrom(const SoaVector& other, std::index_sequence<I...>) {
+        size_t done = 0;
+        try {
+            ((CopyColumn<I>(other), ++done), ...);
+        }
+        catch (...) {
+            DestroyFirstColumns(done, 0, other.size_, Indices{});
+            throw;
+        }
+    }
+
+    template <size_t I>
+    void CopyColumn(const SoaVector& other) {
+        std::allocator<FieldType<I>> alloc;
+        const FieldType<I>* source = std::get<I>(other.columns_).Get();
+        CopyElements(alloc, source, source + other.size_, std::get<I>(columns_).Get());
+    }
+
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+    std::tuple<ArrayPtr<Fields>...> columns_;
+};
\ No newline at end of file
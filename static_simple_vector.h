@@ -0,0 +1,346 @@
+#pragma once
+
+#include "simple_vector.h"
+
+//  StaticSimpleVector   :  ,   .
+//     ,      constexpr-   C++17
+template <typename Type, size_t N, bool = std::is_trivial_v<Type>>
+class StaticSimpleVectorStorage {
+protected:
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+    //       .     
+    //     ,    
+    constexpr StaticSimpleVectorStorage() noexcept {
+        if (std::is_constant_evaluated()) {
+            for (Type& item : items_) {
+                item = Type();
+            }
+        }
+    }
+#endif
+
+    constexpr Type* Data() noexcept {
+        return items_;
+    }
+
+    constexpr const Type* Data() const noexcept {
+        return items_;
+    }
+
+    template <typename... Args>
+    constexpr void Construct(size_t index, Args&&... args) {
+        items_[index] = Type(std::forward<Args>(args)...);
+    }
+
+    constexpr void Destroy(size_t, size_t) noexcept {
+    }
+
+    size_t size_ = 0;
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+    Type items_[N];
+#else
+    //  C++20 constexpr-    ,    
+    Type items_[N] = {};
+#endif
+};
+
+//    :  ,      
+template <typename Type, size_t N>
+class StaticSimpleVectorStorage<Type, N, false> {
+protected:
+    StaticSimpleVectorStorage() noexcept {
+    }
+
+    StaticSimpleVectorStorage(const StaticSimpleVectorStorage& other) {
+        std::allocator<Type> alloc;
+        CopyElements(alloc, other.Data(), other.Data() + other.size_, Data());
+        size_ = other.size_;
+    }
+
+    //  other , other  
+    StaticSimpleVectorStorage(StaticSimpleVectorStorage&& other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        std::allocator<Type> alloc;
+        MoveElements(alloc, other.Data(), other.size_, Data());
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    //   :     
+    StaticSimpleVectorStorage& operator=(const StaticSimpleVectorStorage& rhs) {
+        if (this == &rhs)
+            return *this;
+        Destroy(0, std::exchange(size_, 0));
+        std::allocator<Type> alloc;
+        CopyElements(alloc, rhs.Data(), rhs.Data() + rhs.size_, Data());
+        size_ = rhs.size_;
+        return *this;
+    }
+
+    StaticSimpleVectorStorage& operator=(StaticSimpleVectorStorage&& other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        if (this == &other)
+            return *this;
+        Destroy(0, std::exchange(size_, 0));
+        std::allocator<Type> alloc;
+        MoveElements(alloc, other.Data(), other.size_, Data());
+        size_ = std::exchange(other.size_, 0);
+        return *this;
+    }
+
+    ~StaticSimpleVectorStorage() {
+        Destroy(0, size_);
+    }
+
+    Type* Data() noexcept {
+        return std::launder(reinterpret_cast<Type*>(raw_));
+    }
+
+    const Type* Data() const noexcept {
+        return std::launder(reinterpret_cast<const Type*>(raw_));
+    }
+
+    template <typename... Args>
+    void Construct(size_t index, Args&&... args) {
+        std::allocator<Type> alloc;
+        std::allocator_traits<std::allocator<Type>>::construct(alloc, Data() + index, std::forward<Args>(args)...);
+    }
+
+    void Destroy(size_t first, size_t last) noexcept {
+        std::allocator<Type> alloc;
+        DestroyElements(alloc, Data() + first, Data() + last);
+    }
+
+    size_t size_ = 0;
+    alignas(Type) unsigned char raw_[N * sizeof(Type)];
+};
+
+//    SimpleVector    N,       .
+//    ,       ,    .
+//     ,  , constexpr,       .
+//   SIMPLE_VECTOR_CONSTEXPR        C++20.
+//      std::length_error, TryPushBack    false
+template <typename Type, size_t N>
+class StaticSimpleVector : private StaticSimpleVectorStorage<Type, N> {
+    static_assert(N > 0, "Capacity must be positive");
+
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    constexpr StaticSimpleVector() noexcept = default;
+
+    //    size ,    
+    constexpr explicit StaticSimpleVector(size_t size) {
+        Resize(size);
+    }
+
+    //    size ,   value
+    constexpr StaticSimpleVector(size_t size, const Type& value) {
+        CheckCapacity(size);
+        for (; this->size_ < size; ++this->size_) {
+            this->Construct(this->size_, value);
+        }
+    }
+
+    //    std::initializer_list
+    constexpr StaticSimpleVector(std::initializer_list<Type> init) {
+        CheckCapacity(init.size());
+        for (const Type& value : init) {
+            this->Construct(this->size_, value);
+            ++this->size_;
+        }
+    }
+
+    //     
+    constexpr size_t GetSize() const noexcept {
+        return this->size_;
+    }
+
+    //   ,   
+    static constexpr size_t GetCapacity() noexcept {
+        return N;
+    }
+
+    // ,   
+    constexpr bool IsEmpty() const noexcept {
+        return this->size_ == 0;
+    }
+
+    // ,    
+    constexpr bool IsFull() const noexcept {
+        return this->size_ == N;
+    }
+
+    //       index
+    constexpr Type& operator[](size_t index) noexcept {
+        assert(index < this->size_);
+        return this->Data()[index];
+    }
+
+    constexpr const Type& operator[](size_t index) const noexcept {
+        assert(index < this->size_);
+        return this->Data()[index];
+    }
+
+    //       index.
+    //   std::out_of_range,  index >= size
+    constexpr Type& At(size_t index) {
+        if (index >= this->size_)
+            throw std::out_of_range("Element's index is incorrect (bigger than size)");
+        return this->Data()[index];
+    }
+
+    constexpr const Type& At(size_t index) const {
+        if (index >= this->size_)
+            throw std::out_of_range("Element's index is incorrect (bigger than size)");
+        return this->Data()[index];
+    }
+
+    //   
+    constexpr void Clear() noexcept {
+        this->Destroy(0, this->size_);
+        this->size_ = 0;
+    }
+
+    //   .      .
+    //  std::length_error,  new_size > N
+    constexpr void Resize(size_t new_size) {
+        CheckCapacity(new_size);
+        if (new_size < this->size_) {
+            this->Destroy(new_size, this->size_);
+            this->size_ = new_size;
+        }
+        for (; this->size_ < new_size; ++this->size_) {
+            this->Construct(this->size_);
+        }
+    }
+
+    //     .
+    //  std::length_error,   
+    constexpr void PushBack(const Type& value) {
+        EmplaceBack(value);
+    }
+
+    constexpr void PushBack(Type&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    //    args       
+    template <typename... Args>
+    constexpr Type& EmplaceBack(Args&&... args) {
+        CheckCapacity(this->size_ + 1);
+        this->Construct(this->size_, std::forward<Args>(args)...);
+        return this->Data()[this->size_++];
+    }
+
+    //  ,   .      
+    constexpr bool TryPushBack(const Type& value) {
+        if (IsFull())
+            return false;
+        EmplaceBack(value);
+        return true;
+    }
+
+    constexpr bool TryPushBack(Type&& value) {
+        if (IsFull())
+            return false;
+        EmplaceBack(std::move(value));
+        return true;
+    }
+
+    // ""   .     
+    constexpr void PopBack() noexcept {
+        assert(this->size_ > 0);
+        --this->size_;
+        this->Destroy(this->size_, this->size_ + 1);
+    }
+
+    //   value   pos      .
+    //  std::length_error,   
+    constexpr Iterator Insert(ConstIterator pos, Type value) {
+        assert(pos >= begin() && pos <= end());
+        const size_t index = pos - cbegin();
+        CheckCapacity(this->size_ + 1);
+        if (index == this->size_)
+            return &EmplaceBack(std::move(value));
+        // value   ,     ,   
+        this->Construct(this->size_, std::move(this->Data()[this->size_ - 1]));
+        ++this->size_;
+        for (size_t i = this->size_ - 2; i > index; --i) {
+            this->Data()[i] = std::move(this->Data()[i - 1]);
+        }
+        this->Data()[index] = std::move(value);
+        return begin() + index;
+    }
+
+    //           
+    constexpr Iterator Erase(ConstIterator pos) {
+        assert(pos >= begin() && pos < end());
+        const size_t index = pos - cbegin();
+        for (size_t i = index + 1; i < this->size_; ++i) {
+            this->Data()[i - 1] = std::move(this->Data()[i]);
+        }
+        PopBack();
+        return begin() + index;
+    }
+
+    constexpr Iterator begin() noexcept {
+        return this->Data();
+    }
+
+    constexpr Iterator end() noexcept {
+        return this->Data() + this->size_;
+    }
+
+    constexpr ConstIterator begin() const noexcept {
+        return this->Data();
+    }
+
+    constexpr ConstIterator end() const noexcept {
+        return this->Data() + this->size_;
+    }
+
+    constexpr ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    constexpr ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    static constexpr void CheckCapacity(size_t size) {
+        if (size > N)
+            throw std::length_error("StaticSimpleVector capacity exceeded");
+    }
+};
+
+//    EqualElements  CompareElements     memcmp,
+//  constexpr     SimpleVector,   C++20
+template <typename Type, size_t N>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator==(const StaticSimpleVector<Type, N>& lhs, const StaticSimpleVector<Type, N>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && EqualElements(lhs.begin(), rhs.begin(), lhs.GetSize());
+}
+
+template <typename Type, size_t N>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator!=(const StaticSimpleVector<Type, N>& lhs, const StaticSimpleVector<Type, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator<(const StaticSimpleVector<Type, N>& lhs, const StaticSimpleVector<Type, N>& rhs) {
+    return CompareElements(lhs.begin(), lhs.GetSize(), rhs.begin(), rhs.GetSize()) < 0;
+}
+
+template <typename Type, size_t N>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator<=(const StaticSimpleVector<Type, N>& lhs, const StaticSimpleVector<Type, N>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t N>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator>(const StaticSimpleVector<Type, N>& lhs, const StaticSimpleVector<Type, N>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t N>
+inline SIMPLE_VECTOR_CONSTEXPR bool operator>=(const StaticSimpleVector<Type, N>& lhs, const StaticSimpleVector<Type, N>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+// ,       
+class X {
+public:
+    X()
+        : X(5) {
+    }
+
+    X(size_t num)
+        : x_(num) {
+    }
+
+    X(const X& other) = delete;
+
+    X& operator=(const X& other) = delete;
+
+    X(X&& other) noexcept {
+        x_ = std::exchange(other.x_, 0);
+    }
+
+    X& operator=(X&& other) noexcept {
+        x_ = std::exchange(other.x_, 0);
+        return *this;
+    }
+
+    size_t GetX() const {
+        return x_;
+    }
+
+private:
+    size_t x_;
+};
@@ -3,8 +3,32 @@
 #include <stdexcept>
 #include <iostream>
 #include <numeric>
+#include <string>
+#include <memory>
+#include <memory_resource>
+#include <list>
+#include <sstream>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+#include <array>
 
 #include "simple_vector.h"
+#include "test_types.h"
+#include "small_simple_vector.h"
+#include "cow_simple_vector.h"
+#include "mapped_simple_vector.h"
+#include "simple_vector_serialization.h"
+#include "simple_vector_view.h"
+#include "concurrent_simple_vector.h"
+#include "segmented_simple_vector.h"
+#include "soa_vector.h"
+#include "static_simple_vector.h"
+#include "flat_map.h"
+#include "huge_page_allocator.h"
+#include "buffer_queue.h"
+#include "allocators.h"
 #include "array_ptr.h"
 
 //  ,    inline,   
@@ -279,37 +303,6 @@ void TestReserveMethod() {
     cout << "Done!"s << endl;
 }
 
-class X {
-public:
-    X()
-        : X(5) {
-    }
-
-    X(size_t num)
-        : x_(num) {
-    }
-
-    X(const X& other) = delete;
-
-    X& operator=(const X& other) = delete;
-
-    X(X&& other) noexcept {
-        x_ = std::exchange(other.x_, 0);
-    }
-
-    X& operator=(X&& other) noexcept {
-        x_ = std::exchange(other.x_, 0);
-        return *this;
-    }
-
-    size_t GetX() const {
-        return x_;
-    }
-
-private:
-    size_t x_;
-};
-
 SimpleVector<int> GenerateVector(size_t size) {
     SimpleVector<int> v(size);
     std::iota(v.begin(), v.end(), 1);
@@ -318,8 +311,8 @@ SimpleVector<int> GenerateVector(size_t size) {
 
 void TestMoveArrayPtr() {
     {
-        int* test = new int[5]{ 1, 2, 3, 4, 5 };
-        ArrayPtr<int> ptr_from(test);
+        int* test = ArrayPtr<int>(5).Release();
+        ArrayPtr<int> ptr_from(test, 5);
         assert(&ptr_from[2] == &test[2]);
         
         ArrayPtr<int> ptr_to(std::move(ptr_from));
@@ -327,8 +320,8 @@ void TestMoveArrayPtr() {
         assert(ptr_from.Get() == nullptr);
     }
     {
-        int* test = new int[5]{ 1, 2, 3, 4, 5 };
-        ArrayPtr<int> ptr_from(test);
+        int* test = ArrayPtr<int>(5).Release();
+        ArrayPtr<int> ptr_from(test, 5);
 
         ArrayPtr<int> ptr_to = std::move(ptr_from);
         assert(&ptr_to[2] == &test[2]);
@@ -465,6 +458,2498 @@ void TestNoncopiableResize() {
     std::cout << "Done!" << std::endl << std::endl;
 }
 
+//   ,  ,     
+struct LiveCounter {
+    LiveCounter() {
+        ++alive;
+        ++constructed;
+    }
+    LiveCounter(const LiveCounter&) {
+        ++alive;
+        ++constructed;
+    }
+    LiveCounter(LiveCounter&&) noexcept {
+        ++alive;
+        ++constructed;
+    }
+    LiveCounter& operator=(const LiveCounter&) = default;
+    LiveCounter& operator=(LiveCounter&&) = default;
+    ~LiveCounter() {
+        --alive;
+    }
+
+    static inline int alive = 0;
+    static inline int constructed = 0;
+};
+
+void TestUninitializedStorage() {
+    using namespace std;
+    cout << "TestUninitializedStorage"s << endl;
+    {
+        SimpleVector<LiveCounter> v;
+        // Reserve   
+        v.Reserve(1000);
+        assert(LiveCounter::constructed == 0);
+        assert(LiveCounter::alive == 0);
+
+        v.PushBack(LiveCounter());
+        v.PushBack(LiveCounter());
+        v.PushBack(LiveCounter());
+        assert(LiveCounter::alive == 3);
+
+        v.PopBack();
+        assert(LiveCounter::alive == 2);
+
+        // Resize       
+        v.Resize(10);
+        assert(LiveCounter::alive == 10);
+        v.Resize(4);
+        assert(LiveCounter::alive == 4);
+
+        //          
+        v.Reserve(5000);
+        assert(LiveCounter::alive == 4);
+
+        v.Clear();
+        assert(LiveCounter::alive == 0);
+        assert(v.GetCapacity() == 5000);
+        v.Resize(2);
+    }
+    //     
+    assert(LiveCounter::alive == 0);
+    {
+        SimpleVector<LiveCounter> v(3);
+        SimpleVector<LiveCounter> copy(v);
+        assert(LiveCounter::alive == 6);
+        copy = std::move(v);
+        assert(LiveCounter::alive == 3);
+    }
+    assert(LiveCounter::alive == 0);
+    cout << "Done!"s << endl;
+}
+
+void TestEmplace() {
+    using namespace std;
+    cout << "TestEmplace"s << endl;
+    {
+        SimpleVector<LiveCounter> v;
+        v.Reserve(2);
+        LiveCounter::constructed = 0;
+        //      ,   
+        v.EmplaceBack();
+        assert(LiveCounter::constructed == 1);
+        assert(LiveCounter::alive == 1);
+    }
+    assert(LiveCounter::alive == 0);
+    {
+        SimpleVector<std::pair<std::string, int>> v;
+        auto& item = v.EmplaceBack("b"s, 2);
+        assert(&item == &v[0]);
+        v.Emplace(v.begin(), "a"s, 1);
+        v.Emplace(v.end(), "d"s, 4);
+        auto it = v.Emplace(v.begin() + 2, "c"s, 3);
+        assert(it == v.begin() + 2);
+        assert(v.GetSize() == 4);
+        for (int i = 0; i < 4; ++i) {
+            assert(v[i].second == i + 1);
+            assert(v[i].first == std::string(1, static_cast<char>('a' + i)));
+        }
+    }
+    //       ,     
+    {
+        SimpleVector<std::string> v{ "first"s, "second"s };
+        assert(v.GetSize() == v.GetCapacity());
+        v.EmplaceBack(v[0]);
+        v.Emplace(v.begin(), v[1]);
+        assert((v == SimpleVector<std::string>{ "second"s, "first"s, "second"s, "first"s }));
+    }
+    {
+        SimpleVector<X> v;
+        for (size_t i = 0; i < 5; ++i) {
+            v.EmplaceBack(i);
+        }
+        v.Emplace(v.begin() + 1, size_t{ 42 });
+        assert(v[1].GetX() == 42);
+        assert(v[2].GetX() == 1);
+    }
+    cout << "Done!"s << endl;
+}
+
+//    ,     
+struct Handle {
+    Handle(int value)
+        :ptr(std::make_unique<int>(value))
+    {
+    }
+
+    std::unique_ptr<int> ptr;
+};
+
+template <>
+struct IsTriviallyRelocatable<Handle> : std::true_type {
+};
+
+void TestTriviallyRelocatable() {
+    using namespace std;
+    cout << "TestTriviallyRelocatable"s << endl;
+    static_assert(IsTriviallyRelocatableV<int>);
+    static_assert(!IsTriviallyRelocatableV<std::string>);
+    {
+        SimpleVector<int> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+        v.Insert(v.begin(), -1);
+        v.Insert(v.begin() + 50, -2);
+        v.Insert(v.end(), -3);
+        assert(v.GetSize() == 103);
+        assert(v[0] == -1 && v[1] == 0);
+        assert(v[50] == -2 && v[51] == 49);
+        assert(v[102] == -3 && v[101] == 99);
+
+        v.Erase(v.begin());
+        v.Erase(v.begin() + 49);
+        v.Erase(v.end() - 1);
+        for (int i = 0; i < 100; ++i) {
+            assert(v[i] == i);
+        }
+    }
+    {
+        SimpleVector<Handle> v;
+        for (int i = 0; i < 10; ++i) {
+            v.EmplaceBack(i);
+        }
+        v.Reserve(100);
+        v.Emplace(v.begin() + 3, 42);
+        assert(*v[3].ptr == 42);
+        assert(*v[4].ptr == 3);
+        v.Erase(v.begin() + 3);
+        for (int i = 0; i < 10; ++i) {
+            assert(*v[i].ptr == i);
+        }
+    }
+    cout << "Done!"s << endl;
+}
+
+// ,     
+template <typename Type>
+struct CountingAllocator {
+    using value_type = Type;
+
+    CountingAllocator() = default;
+
+    explicit CountingAllocator(int* counter)
+        :allocations(counter)
+    {
+    }
+
+    template <typename Other>
+    CountingAllocator(const CountingAllocator<Other>& other) noexcept
+        :allocations(other.allocations)
+    {
+    }
+
+    Type* allocate(size_t n) {
+        ++*allocations;
+        return std::allocator<Type>().allocate(n);
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept {
+        --*allocations;
+        std::allocator<Type>().deallocate(ptr, n);
+    }
+
+    template <typename Other>
+    bool operator==(const CountingAllocator<Other>& other) const noexcept {
+        return allocations == other.allocations;
+    }
+
+    template <typename Other>
+    bool operator!=(const CountingAllocator<Other>& other) const noexcept {
+        return !(*this == other);
+    }
+
+    int* allocations = nullptr;
+};
+
+// CountingAllocator,       
+template <typename Type>
+struct PropagatingAllocator : CountingAllocator<Type> {
+    using propagate_on_container_move_assignment = std::true_type;
+    using CountingAllocator<Type>::CountingAllocator;
+
+    template <typename Other>
+    struct rebind {
+        using other = PropagatingAllocator<Other>;
+    };
+};
+
+void TestAllocator() {
+    using namespace std;
+    cout << "TestAllocator"s << endl;
+    {
+        //       
+        int first = 0;
+        int second = 0;
+        ArrayPtr<int, PropagatingAllocator<int>> empty(PropagatingAllocator<int>{ &first });
+        ArrayPtr<int, PropagatingAllocator<int>> other(PropagatingAllocator<int>{ &second });
+        empty = std::move(other);
+        assert(empty.GetAllocator().allocations == &second);
+        empty = std::move(empty);
+        assert(empty.GetAllocator().allocations == &second);
+    }
+    {
+        int allocations = 0;
+        {
+            CountingAllocator<int> alloc(&allocations);
+            SimpleVector<int, CountingAllocator<int>> v(alloc);
+            assert(allocations == 0);
+            v.Reserve(10);
+            assert(allocations == 1);
+            for (int i = 0; i < 100; ++i) {
+                v.PushBack(i);
+            }
+            //      
+            assert(allocations == 1);
+
+            auto copy(v);
+            assert(allocations == 2);
+            assert(copy == v);
+            assert(copy.GetAllocator() == alloc);
+
+            auto moved(std::move(copy));
+            assert(allocations == 2);
+        }
+        assert(allocations == 0);
+    }
+    //    std::pmr
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        SimpleVector<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>> v(&arena);
+        v.PushBack("arena string long enough to skip small string optimization");
+        v.EmplaceBack("second");
+        assert(v.GetAllocator().resource() == &arena);
+        //     (uses-allocator construction)
+        assert(v[0].get_allocator().resource() == &arena);
+
+        //     ,   std::pmr::vector
+        auto copy(v);
+        assert(copy.GetAllocator().resource() == std::pmr::get_default_resource());
+        assert(copy[0] == v[0]);
+
+        //        
+        std::pmr::monotonic_buffer_resource other_arena;
+        SimpleVector<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>> other(&other_arena);
+        other = std::move(v);
+        assert(other.GetAllocator().resource() == &other_arena);
+        assert(other.GetSize() == 2);
+        assert(other[1] == "second");
+        assert(other[0].get_allocator().resource() == &other_arena);
+        assert(v.IsEmpty());
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestSmallSimpleVector() {
+    using namespace std;
+    cout << "TestSmallSimpleVector"s << endl;
+    {
+        int allocations = 0;
+        {
+            CountingAllocator<int> alloc(&allocations);
+            SmallSimpleVector<int, 4, CountingAllocator<int>> v(alloc);
+            assert(v.GetCapacity() == 4);
+            for (int i = 0; i < 4; ++i) {
+                v.PushBack(i);
+            }
+            //      ,   
+            assert(allocations == 0);
+            assert(v.IsInline());
+
+            v.PushBack(4);
+            assert(allocations == 1);
+            assert(!v.IsInline());
+            assert(v.GetCapacity() == 8);
+            for (int i = 0; i < 5; ++i) {
+                assert(v[i] == i);
+            }
+        }
+        assert(allocations == 0);
+    }
+    {
+        SmallSimpleVector<std::string, 2> v{ "a"s, "b"s };
+        assert(v.IsInline());
+        v.Insert(v.begin(), "c"s);
+        assert(!v.IsInline());
+        assert((v == SmallSimpleVector<std::string, 2>{ "c"s, "a"s, "b"s }));
+        v.Erase(v.begin() + 1);
+        assert((v == SmallSimpleVector<std::string, 2>{ "c"s, "b"s }));
+
+        SmallSimpleVector<std::string, 2> inline_copy{ "x"s };
+        //         
+        v.swap(inline_copy);
+        assert(v.GetSize() == 1 && v[0] == "x"s && v.IsInline());
+        assert(inline_copy.GetSize() == 2 && inline_copy[1] == "b"s);
+
+        auto copy(inline_copy);
+        assert(copy == inline_copy);
+        copy = v;
+        assert(copy == v);
+    }
+    // :  ,    
+    {
+        SmallSimpleVector<X, 3> inline_vector;
+        SmallSimpleVector<X, 3> heap_vector;
+        for (size_t i = 0; i < 5; ++i) {
+            if (i < 3)
+                inline_vector.EmplaceBack(i);
+            heap_vector.EmplaceBack(i);
+        }
+        const X* heap_data = heap_vector.begin();
+
+        SmallSimpleVector<X, 3> moved_heap(std::move(heap_vector));
+        assert(moved_heap.begin() == heap_data);
+        assert(heap_vector.IsEmpty() && heap_vector.IsInline());
+
+        SmallSimpleVector<X, 3> moved_inline(std::move(inline_vector));
+        assert(moved_inline.IsInline());
+        assert(moved_inline.GetSize() == 3);
+        assert(moved_inline[2].GetX() == 2);
+        assert(inline_vector.IsEmpty());
+
+        moved_inline = std::move(moved_heap);
+        assert(moved_inline.GetSize() == 5);
+        assert(moved_inline.begin() == heap_data);
+        moved_inline.Resize(2);
+        assert(moved_inline[1].GetX() == 1);
+    }
+    {
+        SmallSimpleVector<LiveCounter, 2> v(2);
+        v.Resize(5);
+        assert(LiveCounter::alive == 5);
+        v.Clear();
+        assert(LiveCounter::alive == 0);
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestGrowthPolicy() {
+    using namespace std;
+    cout << "TestGrowthPolicy"s << endl;
+    {
+        SimpleVector<int, std::allocator<int>, GrowthOneAndHalf> v;
+        v.PushBack(0);
+        assert(v.GetCapacity() == 1);
+        v.PushBack(1);
+        assert(v.GetCapacity() == 2);
+        v.PushBack(2);
+        assert(v.GetCapacity() == 4);
+        v.PushBack(3);
+        v.PushBack(4);
+        assert(v.GetCapacity() == 7);
+        v.Resize(100);
+        assert(v.GetCapacity() == 100);
+    }
+    {
+        SimpleVector<int, std::allocator<int>, GrowthPageRounded<>> v;
+        v.PushBack(1);
+        //       
+        assert(v.GetCapacity() == 1);
+        v.Resize(3);
+        assert(v.GetCapacity() * sizeof(int) == 16);
+        //     
+        v.Resize(5000);
+        assert(v.GetCapacity() * sizeof(int) % 4096 == 0);
+        assert(v.GetCapacity() >= 5000);
+    }
+    {
+        //  12-       :  64   5 
+        SimpleVector<std::array<int, 3>, std::allocator<std::array<int, 3>>, GrowthPageRounded<>> v;
+        v.Resize(3);
+        assert(v.GetCapacity() == 5);
+    }
+    //   realloc  
+    {
+        SimpleVector<int, MallocAllocator<int>> v;
+        for (int i = 0; i < 10000; ++i) {
+            v.PushBack(i);
+        }
+        v.Insert(v.begin() + 1, -1);
+        v.Reserve(100000);
+        assert(v.GetCapacity() == 100000);
+        assert(v.GetSize() == 10001);
+        assert(v[0] == 0 && v[1] == -1 && v[10000] == 9999);
+
+        //     ,   realloc  
+        SimpleVector<int, MallocAllocator<int>> w{ 7 };
+        w.PushBack(w[0]);
+        w.Emplace(w.begin(), w[1]);
+        assert((w == SimpleVector<int, MallocAllocator<int>>{ 7, 7, 7 }));
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestRangeOperations() {
+    using namespace std;
+    cout << "TestRangeOperations"s << endl;
+    //        SimpleVector(size, value)
+    {
+        SimpleVector<size_t> v(3, 7);
+        assert(v.GetSize() == 3 && v[0] == 7);
+
+        std::list<std::string> words{ "a"s, "b"s, "c"s };
+        SimpleVector<std::string> from_list(words.begin(), words.end());
+        assert(from_list.GetSize() == 3 && from_list.GetCapacity() == 3);
+        assert(from_list[2] == "c"s);
+
+        std::istringstream input("1 2 3 4");
+        SimpleVector<int> from_stream{ std::istream_iterator<int>(input), std::istream_iterator<int>() };
+        assert((from_stream == SimpleVector<int>{ 1, 2, 3, 4 }));
+    }
+    // Append    
+    {
+        int allocations = 0;
+        SimpleVector<int, CountingAllocator<int>> v{ { 1, 2 }, CountingAllocator<int>(&allocations) };
+        const int appended[] = { 3, 4, 5, 6, 7 };
+        v.Append(std::begin(appended), std::end(appended));
+        assert(allocations == 1);
+        assert(v.GetSize() == 7 && v[6] == 7);
+    }
+    // InsertRange  ,        
+    {
+        SimpleVector<int> v{ 1, 5 };
+        const int middle[] = { 2, 3, 4 };
+        v.InsertRange(v.begin() + 1, std::begin(middle), std::end(middle));
+        assert((v == SimpleVector<int>{ 1, 2, 3, 4, 5 }));
+        v.Reserve(20);
+        auto it = v.InsertRange(v.begin(), std::begin(middle), std::end(middle));
+        assert(it == v.begin());
+        assert((v == SimpleVector<int>{ 2, 3, 4, 1, 2, 3, 4, 5 }));
+    }
+    {
+        SimpleVector<std::string> v{ "a"s, "b"s, "c"s, "d"s };
+        v.Reserve(20);
+        const std::string short_range[] = { "x"s };
+        const std::string long_range[] = { "p"s, "q"s, "r"s, "s"s };
+        //   
+        v.InsertRange(v.begin() + 1, std::begin(short_range), std::end(short_range));
+        assert((v == SimpleVector<std::string>{ "a"s, "x"s, "b"s, "c"s, "d"s }));
+        //   
+        v.InsertRange(v.begin() + 3, std::begin(long_range), std::end(long_range));
+        assert((v == SimpleVector<std::string>{ "a"s, "x"s, "b"s, "p"s, "q"s, "r"s, "s"s, "c"s, "d"s }));
+
+        std::list<std::string> words{ "1"s, "2"s };
+        v.InsertRange(v.end(), words.begin(), words.end());
+        assert(v.GetSize() == 11 && v[10] == "2"s);
+    }
+    //      
+    {
+        SimpleVector<std::string> v{ "a"s, "b"s, "c"s };
+        v.InsertRange(v.begin(), v.begin(), v.end());
+        assert((v == SimpleVector<std::string>{ "a"s, "b"s, "c"s, "a"s, "b"s, "c"s }));
+        v.Reserve(20);
+        v.InsertRange(v.begin() + 1, v.begin() + 4, v.end());
+        assert((v == SimpleVector<std::string>{ "a"s, "b"s, "c"s, "b"s, "c"s, "a"s, "b"s, "c"s }));
+    }
+    // Assign  
+    {
+        SimpleVector<int> v(10, 1);
+        const int* data = v.begin();
+        const int values[] = { 4, 5 };
+        v.Assign(std::begin(values), std::end(values));
+        assert(v.begin() == data);
+        assert((v == SimpleVector<int>{ 4, 5 }));
+        v.Assign(v.begin() + 1, v.end());
+        assert((v == SimpleVector<int>{ 5 }));
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestShrink() {
+    using namespace std;
+    cout << "TestShrink"s << endl;
+    {
+        SimpleVector<std::string> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(std::to_string(i));
+        }
+        v.Resize(10);
+        assert(v.GetCapacity() == 128);
+
+        //       
+        assert(!v.ShrinkIf(0.05));
+        assert(v.ShrinkIf(0.5));
+        assert(v.GetCapacity() == 10);
+        assert(v[9] == "9"s);
+
+        v.ShrinkToFit();
+        assert(v.GetCapacity() == 10);
+
+        v.Clear();
+        v.ShrinkToFit();
+        assert(v.GetCapacity() == 0);
+        assert(v.begin() == nullptr);
+        v.PushBack("again"s);
+        assert(v[0] == "again"s);
+    }
+    {
+        SimpleVector<int, MallocAllocator<int>> v(1000, 1);
+        v.Resize(3);
+        v.ShrinkToFit();
+        assert(v.GetCapacity() == 3);
+        assert((v == SimpleVector<int, MallocAllocator<int>>{ 1, 1, 1 }));
+    }
+    {
+        const size_t size = 1 << 20;
+        SimpleVector<char> v(size, 'x');
+        v.Resize(10);
+        const size_t released = v.DiscardUnusedTail();
+        assert(released < size);
+        assert(v.GetCapacity() == size);
+        assert(v[9] == 'x');
+        //      
+        v.Resize(size);
+        v[size - 1] = 'y';
+        assert(v[size - 1] == 'y');
+    }
+    cout << "Done!"s << endl;
+}
+
+template <typename Vector>
+bool IsAligned(const Vector& v, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(v.begin()) % alignment == 0;
+}
+
+void TestAlignedStorage() {
+    using namespace std;
+    cout << "TestAlignedStorage"s << endl;
+    {
+        SimpleVector<float, Aligned<64>> v(3, 1.5f);
+        assert(IsAligned(v, 64));
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(static_cast<float>(i));
+            assert(IsAligned(v, 64));
+        }
+        v.Reserve(5000);
+        assert(IsAligned(v, 64));
+
+        auto copy(v);
+        assert(IsAligned(copy, 64));
+        assert(copy == v);
+
+        SimpleVector<float, Aligned<64>> moved(std::move(copy));
+        assert(IsAligned(moved, 64));
+
+        moved.Resize(7);
+        moved.ShrinkToFit();
+        assert(IsAligned(moved, 64));
+        assert(moved[0] == 1.5f && moved[3] == 0.0f);
+    }
+    {
+        SimpleVector<std::string, Aligned<128>> v{ "a"s, "b"s };
+        v.Insert(v.begin(), "c"s);
+        assert(IsAligned(v, 128));
+        assert(v[0] == "c"s);
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestStats() {
+    using namespace std;
+    cout << "TestStats"s << endl;
+    SimpleVectorStatsRegistry::Reset();
+    SimpleVector<std::string> v;
+    for (int i = 0; i < 8; ++i) {
+        v.PushBack("value"s);
+    }
+    auto copy(v);
+    copy.Insert(copy.begin(), "first"s);
+
+    const SimpleVectorStats stats = v.GetStats();
+    const SimpleVectorStats copy_stats = copy.GetStats();
+    const SimpleVectorStats global = SimpleVectorStatsRegistry::Snapshot();
+    if constexpr (kSimpleVectorStatsEnabled) {
+        //  1, 2, 4, 8:  ,      
+        assert(stats.allocations == 4);
+        assert(stats.regrowths == 3);
+        assert(stats.bytes_allocated == (1 + 2 + 4 + 8) * sizeof(std::string));
+        assert(stats.element_moves == 1 + 2 + 4);
+        assert(stats.peak_capacity == 8);
+
+        //    ,    16  
+        assert(copy_stats.element_copies == 8);
+        assert(copy_stats.allocations == 2);
+        assert(copy_stats.peak_capacity == 16);
+
+        assert(global.allocations == stats.allocations + copy_stats.allocations);
+        assert(global.peak_capacity == 16);
+    }
+    else {
+        //  SIMPLE_VECTOR_ENABLE_STATS       
+        assert(stats.allocations == 0 && copy_stats.allocations == 0 && global.allocations == 0);
+        assert(sizeof(SimpleVector<int>) == 2 * sizeof(size_t) + sizeof(ArrayPtr<int>));
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestBatchErase() {
+    using namespace std;
+    cout << "TestBatchErase"s << endl;
+    {
+        SimpleVector<int> v{ 0, 1, 2, 3, 4, 5, 6, 7 };
+        auto it = v.Erase(v.begin() + 2, v.begin() + 5);
+        assert(*it == 5);
+        assert((v == SimpleVector<int>{ 0, 1, 5, 6, 7 }));
+        it = v.Erase(v.begin() + 3, v.end());
+        assert(it == v.end());
+        assert((v == SimpleVector<int>{ 0, 1, 5 }));
+        v.Erase(v.begin(), v.begin());
+        assert(v.GetSize() == 3);
+        v.Erase(v.begin(), v.end());
+        assert(v.IsEmpty());
+    }
+    {
+        SimpleVector<std::string> v{ "keep"s, "drop"s, "drop"s, "keep"s, "drop"s, "keep"s };
+        v.Erase(v.begin(), v.begin() + 1);
+        assert(v.GetSize() == 5 && v[0] == "drop"s);
+        assert(v.EraseIf([](const std::string& s) { return s == "drop"s; }) == 3);
+        assert((v == SimpleVector<std::string>{ "keep"s, "keep"s }));
+        assert(v.EraseIf([](const std::string&) { return false; }) == 0);
+    }
+    //   
+    {
+        SimpleVector<LiveCounter> v(10);
+        v.Erase(v.begin() + 1, v.begin() + 4);
+        assert(LiveCounter::alive == 7);
+        size_t index = 0;
+        assert(v.EraseIf([&index](const LiveCounter&) { return index++ % 2 == 0; }) == 4);
+        assert(LiveCounter::alive == 3);
+    }
+    assert(LiveCounter::alive == 0);
+    {
+        SimpleVector<X> v;
+        for (size_t i = 0; i < 10; ++i) {
+            v.EmplaceBack(i);
+        }
+        v.EraseIf([](const X& x) { return x.GetX() % 3 != 0; });
+        assert(v.GetSize() == 4);
+        assert(v[3].GetX() == 9);
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestSwapErase() {
+    using namespace std;
+    cout << "TestSwapErase"s << endl;
+    {
+        SimpleVector<int> v{ 0, 1, 2, 3, 4 };
+        auto it = v.SwapErase(v.begin() + 1);
+        assert(*it == 4);
+        assert((v == SimpleVector<int>{ 0, 4, 2, 3 }));
+        it = v.SwapErase(v.end() - 1);
+        assert(it == v.end());
+        assert((v == SimpleVector<int>{ 0, 4, 2 }));
+        v.SwapErase(v.begin());
+        v.SwapErase(v.begin());
+        v.SwapErase(v.begin());
+        assert(v.IsEmpty());
+    }
+    {
+        SimpleVector<std::string> v{ "a"s, "b"s, "c"s };
+        v.SwapErase(v.begin());
+        assert((v == SimpleVector<std::string>{ "c"s, "b"s }));
+    }
+    {
+        SimpleVector<X> v;
+        for (size_t i = 0; i < 5; ++i) {
+            v.EmplaceBack(i);
+        }
+        v.SwapErase(v.begin() + 2);
+        assert(v.GetSize() == 4);
+        assert(v[2].GetX() == 4);
+    }
+    {
+        SimpleVector<LiveCounter> v(4);
+        v.SwapErase(v.begin());
+        assert(LiveCounter::alive == 3);
+    }
+    assert(LiveCounter::alive == 0);
+    cout << "Done!"s << endl;
+}
+
+//     -1  ,      
+struct ParallelThrower {
+    explicit ParallelThrower(int v)
+        :value(v)
+    {
+        ++alive;
+    }
+    ParallelThrower(const ParallelThrower& other)
+        :value(other.value)
+    {
+        if (other.value < 0)
+            throw std::runtime_error("copy failed");
+        ++alive;
+    }
+    ParallelThrower& operator=(const ParallelThrower&) = default;
+    ~ParallelThrower() {
+        --alive;
+    }
+
+    int value;
+    static inline std::atomic<int> alive{ 0 };
+};
+
+void TestParallel() {
+    using namespace std;
+    cout << "TestParallel"s << endl;
+    const Parallel policy{ 1000, 4 };
+    const size_t size = 100'003;
+    {
+        SimpleVector<int> source(size);
+        std::iota(source.begin(), source.end(), 0);
+        SimpleVector<int> copy(source, policy);
+        assert(copy == source);
+        assert(ParallelEqual(copy, source, policy));
+        assert(!ParallelLess(copy, source, policy));
+
+        copy[size - 2] = -1;
+        assert(!ParallelEqual(copy, source, policy));
+        assert(ParallelLess(copy, source, policy));
+        assert(!ParallelLess(source, copy, policy));
+        copy[5] = 1'000'000;
+        assert(ParallelLess(source, copy, policy) == (source < copy));
+
+        SimpleVector<int> prefix(source.begin(), source.begin() + 50'000);
+        assert(ParallelLess(prefix, source, policy));
+        assert(!ParallelEqual(prefix, source, policy));
+
+        SimpleVector<int> assigned{ 1, 2, 3 };
+        assigned.Assign(source, policy);
+        assert(assigned == source);
+    }
+    {
+        SimpleVector<std::string> filled(size, "parallel fill"s, policy);
+        assert(filled.GetSize() == size);
+        assert(std::all_of(filled.begin(), filled.end(), [](const std::string& s) { return s == "parallel fill"s; }));
+        SimpleVector<std::string> copy(filled, policy);
+        assert(ParallelEqual(copy, filled, policy));
+    }
+    //     
+    {
+        SimpleVector<int> small{ 1, 2 };
+        SimpleVector<int> copy(small, policy);
+        assert(ParallelEqual(small, copy));
+        SimpleVector<int> empty;
+        assert(ParallelLess(empty, small));
+        assert(!ParallelLess(empty, empty));
+    }
+    //     :     
+    {
+        SimpleVector<ParallelThrower> source;
+        source.Reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            source.EmplaceBack(i == size * 3 / 4 ? -1 : static_cast<int>(i));
+        }
+        try {
+            SimpleVector<ParallelThrower> copy(source, policy);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(ParallelThrower::alive == static_cast<int>(size));
+    }
+    assert(ParallelThrower::alive == 0);
+    //       
+    {
+        std::pmr::monotonic_buffer_resource resource;
+        SimpleVector<int, std::pmr::polymorphic_allocator<int>> v(size, 7, policy, &resource);
+        SimpleVector<int, std::pmr::polymorphic_allocator<int>> copy(v, policy);
+        assert(copy == v);
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestCompare() {
+    using namespace std;
+    cout << "TestCompare"s << endl;
+    {
+        SimpleVector<uint8_t> a{ 1, 200, 3 };
+        SimpleVector<uint8_t> b{ 1, 100, 3 };
+        assert(b < a && a > b && b <= a && a >= b && a != b);
+        assert(SimpleVector<uint8_t>{} < b);
+        SimpleVector<uint8_t> prefix{ 1, 200 };
+        assert(prefix < a && prefix <= a && !(prefix >= a));
+    }
+    //       memcmp
+    {
+        SimpleVector<int> a(1000, 5);
+        SimpleVector<int> b(1000, 5);
+        assert(a == b && a <= b && a >= b && !(a < b) && !(a > b));
+        a[700] = -1;
+        b[700] = 1;
+        assert(a < b && a != b);
+        b[700] = 256;
+        a[700] = 1;
+        assert(a < b);
+        a[999] = 6;
+        a[700] = 256;
+        assert(a > b);
+        b.PopBack();
+        assert(b < a);
+    }
+    {
+        SimpleVector<signed char> a{ -1 };
+        SimpleVector<signed char> b{ 1 };
+        assert(a < b);
+        SimpleVector<std::byte> c{ std::byte{ 0xF0 } };
+        SimpleVector<std::byte> d{ std::byte{ 0x0F } };
+        assert(d < c && c != d);
+    }
+    {
+        SimpleVector<std::string> a{ "abc"s, "b"s };
+        SimpleVector<std::string> b{ "abc"s, "c"s };
+        assert(a < b && b > a && a <= a && a >= a && a != b);
+        SimpleVector<double> c{ 0.5, -1.0 };
+        SimpleVector<double> d{ 0.5, 1.0 };
+        assert(c < d);
+    }
+#if defined(__cpp_lib_three_way_comparison)
+    {
+        SimpleVector<int> a{ 1, -2 };
+        SimpleVector<int> b{ 1, 2 };
+        assert((a <=> b) < 0);
+        assert((b <=> b) == 0);
+        SimpleVector<std::string> c{ "x"s };
+        assert((c <=> SimpleVector<std::string>{ "y"s }) < 0);
+    }
+#endif
+    {
+        SmallSimpleVector<int, 2> a{ 1, -2, 3 };
+        SmallSimpleVector<int, 2> b{ 1, 2 };
+        assert(a < b && b > a && a != b);
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestCopyOnWrite() {
+    using namespace std;
+    cout << "TestCopyOnWrite"s << endl;
+    {
+        CowSimpleVector<int> original{ 1, 2, 3 };
+        CowSimpleVector<int> copy = original;
+        assert(original.IsShared() && copy.IsShared());
+        assert(&std::as_const(copy)[0] == &std::as_const(original)[0]);
+        assert(copy.cbegin() == original.cbegin());
+
+        copy[1] = 20;
+        assert(!original.IsShared() && !copy.IsShared());
+        assert(original[1] == 2 && copy[1] == 20);
+        assert(copy.cbegin() != original.cbegin());
+
+        CowSimpleVector<int> second = original;
+        second.PushBack(4);
+        assert(second.GetSize() == 4 && original.GetSize() == 3);
+        assert(second.GetCapacity() >= 4);
+
+        CowSimpleVector<int> third = original;
+        third.Erase(third.cbegin());
+        third.Insert(third.cbegin() + 1, 7);
+        assert((third.View() == SimpleVector<int>{ 2, 7, 3 }));
+        assert((original.View() == SimpleVector<int>{ 1, 2, 3 }));
+        third.Clear();
+        assert(third.IsEmpty() && original.GetSize() == 3);
+    }
+    {
+        CowSimpleVector<std::string> a(3, "cow"s);
+        const CowSimpleVector<std::string> b = a;
+        assert(a == b && !(a < b));
+        assert(b.At(2) == "cow"s);
+        a.At(2) = "bull"s;
+        assert(a != b && a < b);
+        try {
+            a.At(3);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+    }
+    {
+        CowSimpleVector<int> empty;
+        assert(empty.IsEmpty() && !empty.IsShared());
+        CowSimpleVector<int> copy = empty;
+        copy.PushBack(1);
+        assert(empty.IsEmpty() && copy.GetSize() == 1);
+        SimpleVector<int> source{ 5, 6 };
+        const int* data = source.begin();
+        CowSimpleVector<int> adopted(std::move(source));
+        assert(adopted.cbegin() == data);
+        CowSimpleVector<int> moved = std::move(adopted);
+        assert(moved.GetSize() == 2 && adopted.IsEmpty());
+    }
+    {
+        // ,   ,   
+        CowSimpleVector<int> v{ 1, 2, 3 };
+        int& first = v[0];
+        CowSimpleVector<int> copy = v;
+        assert(!v.IsShared() && !copy.IsShared());
+        first = 10;
+        assert(copy.View()[0] == 1 && v.View()[0] == 10);
+        //  Clear   
+        v.Clear();
+        v.PushBack(4);
+        CowSimpleVector<int> shared = v;
+        assert(v.IsShared() && shared.cbegin() == v.cbegin());
+    }
+    {
+        //       
+        const CowSimpleVector<int> base(1000, 1);
+        vector<thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&base, t] {
+                for (int round = 0; round < 50; ++round) {
+                    CowSimpleVector<int> copy = base;
+                    CowSimpleVector<int> another = copy;
+                    copy.PushBack(t);
+                    another[0] = t;
+                    assert(copy.GetSize() == 1001 && copy.View()[0] == 1 && another.View()[0] == t);
+                }
+            });
+        }
+        for (thread& worker : threads) {
+            worker.join();
+        }
+        assert(!base.IsShared() && base.View()[999] == 1);
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestMappedSimpleVector() {
+    using namespace std;
+    cout << "TestMappedSimpleVector"s << endl;
+#if defined(__unix__) || defined(__APPLE__)
+    struct Point {
+        int x;
+        double y;
+    };
+    const std::string path = (std::filesystem::temp_directory_path()
+        / ("simple_vector_mapped_"s + std::to_string(::getpid()) + ".bin"s)).string();
+    std::filesystem::remove(path);
+    const size_t size = 100'000;
+    {
+        MappedSimpleVector<Point> v(path);
+        assert(v.IsEmpty() && v.GetCapacity() > 0);
+        for (size_t i = 0; i < size; ++i) {
+            v.PushBack({ static_cast<int>(i), i * 0.5 });
+        }
+        assert(v.GetSize() == size && v.GetCapacity() >= size);
+        v.PushBack(v[0]);
+        assert(v.GetSize() == size + 1 && v[size].x == 0);
+        v.PopBack();
+        v.Flush();
+    }
+    //           
+    {
+        MappedSimpleVector<Point> v(path);
+        assert(v.GetSize() == size);
+        assert(v[12345].x == 12345 && v[12345].y == 12345 * 0.5);
+        assert(v.At(size - 1).x == static_cast<int>(size - 1));
+        try {
+            v.At(size);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+        v.Resize(size + 10);
+        assert(v[size + 9].x == 0 && v[size + 9].y == 0.0);
+        MappedSimpleVector<Point> moved = std::move(v);
+        assert(moved.GetSize() == size + 10 && v.IsEmpty());
+        moved.Clear();
+    }
+    {
+        MappedSimpleVector<Point> v(path);
+        assert(v.IsEmpty() && v.GetCapacity() >= size + 10);
+#if defined(__linux__)
+        //      ,      
+        v.PushBack({ 7, 7.5 });
+        const size_t capacity = v.GetCapacity();
+        const uintmax_t file_size = std::filesystem::file_size(path);
+        try {
+            v.Reserve((size_t(1) << 48) / sizeof(Point));
+            assert(false);
+        }
+        catch (const std::system_error&) {
+        }
+        assert(std::filesystem::file_size(path) == file_size && v.GetCapacity() == capacity && v[0].x == 7);
+        v.Clear();
+#endif
+    }
+    {
+        MappedSimpleVector<Point> v(path);
+        assert(v.IsEmpty() && v.GetCapacity() >= size + 10);
+        // PopBack       
+        v.PopBack();
+        assert(v.IsEmpty());
+    }
+    {
+        MappedSimpleVector<Point> v(path);
+        assert(v.IsEmpty());
+    }
+    //       
+    try {
+        MappedSimpleVector<char> wrong(path);
+        assert(false);
+    }
+    catch (const std::runtime_error&) {
+    }
+    std::filesystem::remove(path);
+#endif
+    cout << "Done!"s << endl;
+}
+
+void TestSerialization() {
+    using namespace std;
+    cout << "TestSerialization"s << endl;
+    SimpleVector<uint64_t> source(10'001);
+    std::iota(source.begin(), source.end(), uint64_t(1) << 40);
+    {
+        std::stringstream stream;
+        WriteBinary(stream, source);
+        assert(stream.str().size() == sizeof(SerializedHeader) + source.GetSize() * sizeof(uint64_t));
+        SimpleVector<uint64_t> loaded = ReadBinary<uint64_t>(stream);
+        assert(loaded == source);
+        assert(loaded.GetCapacity() == loaded.GetSize());
+    }
+    {
+        const SimpleVector<std::byte> bytes = Serialize(source);
+        SerializedView<uint64_t> view(bytes.begin(), bytes.GetSize());
+        assert(view.GetSize() == source.GetSize());
+        assert(std::equal(view.begin(), view.end(), source.begin()));
+        assert(view.At(10'000) == source[10'000]);
+        assert(static_cast<const void*>(view.begin()) == bytes.begin() + sizeof(SerializedHeader));
+        assert(view.ToVector() == source);
+        assert(Deserialize<uint64_t>(bytes.begin(), bytes.GetSize()) == source);
+
+        //   :  ,  
+        SimpleVector<std::byte> shifted(1);
+        shifted.Append(bytes.begin(), bytes.end());
+        try {
+            SerializedView<uint64_t> misaligned(shifted.begin() + 1, bytes.GetSize());
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(Deserialize<uint64_t>(shifted.begin() + 1, bytes.GetSize()) == source);
+
+        //  
+        SimpleVector<std::byte> corrupted = bytes;
+        corrupted[sizeof(SerializedHeader) + 100] ^= std::byte{ 1 };
+        auto throws = [](auto&& func) {
+            try {
+                func();
+            }
+            catch (const std::runtime_error&) {
+                return true;
+            }
+            return false;
+        };
+        assert(throws([&] { SerializedView<uint64_t>(corrupted.begin(), corrupted.GetSize()); }));
+        assert(!throws([&] { SerializedView<uint64_t>(corrupted.begin(), corrupted.GetSize(), false); }));
+        assert(throws([&] { Deserialize<uint64_t>(corrupted.begin(), corrupted.GetSize()); }));
+        assert(throws([&] { Deserialize<uint64_t>(bytes.begin(), bytes.GetSize() - 1); }));
+        assert(throws([&] { Deserialize<uint32_t>(bytes.begin(), bytes.GetSize()); }));
+        assert(throws([&] { Deserialize<uint64_t>(bytes.begin(), 4); }));
+        std::stringstream stream(std::string(reinterpret_cast<const char*>(corrupted.begin()), corrupted.GetSize()));
+        assert(throws([&] { ReadBinary<uint64_t>(stream); }));
+        std::stringstream truncated(std::string(reinterpret_cast<const char*>(bytes.begin()), bytes.GetSize() - 8));
+        assert(throws([&] { ReadBinary<uint64_t>(truncated); }));
+    }
+    {
+        //     :    ,    runtime_error
+        SerializedHeader header = MakeSerializedHeader(source.begin(), 0);
+        header.count = uint64_t(1) << 60;
+        const std::string forged(reinterpret_cast<const char*>(&header), sizeof(header));
+        std::stringstream stream(forged + std::string(64, 'x'));
+        bool rejected = false;
+        try {
+            ReadBinary<uint64_t>(stream);
+        }
+        catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        assert(rejected);
+
+        //        ,    
+        struct NonSeekableBuffer : std::stringbuf {
+            using std::stringbuf::stringbuf;
+            pos_type seekoff(off_type, std::ios_base::seekdir, std::ios_base::openmode) override {
+                return pos_type(off_type(-1));
+            }
+            pos_type seekpos(pos_type, std::ios_base::openmode) override {
+                return pos_type(off_type(-1));
+            }
+        };
+        header.count = uint64_t(1) << 34;
+        NonSeekableBuffer forged_buffer(std::string(reinterpret_cast<const char*>(&header), sizeof(header)) + std::string(64, 'x'));
+        std::istream forged_stream(&forged_buffer);
+        rejected = false;
+        try {
+            ReadBinary<uint64_t>(forged_stream);
+        }
+        catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        assert(rejected);
+
+        //     max_count
+        SimpleVector<uint32_t> large(300'000);
+        std::iota(large.begin(), large.end(), 0u);
+        std::stringstream out;
+        WriteBinary(out, large);
+        NonSeekableBuffer large_buffer(out.str());
+        std::istream large_stream(&large_buffer);
+        const SimpleVector<uint32_t> loaded = ReadBinary<uint32_t>(large_stream);
+        assert(loaded == large && loaded.GetCapacity() == large.GetSize());
+        //         
+        std::stringstream seekable(out.str());
+        const SimpleVector<uint32_t> direct = ReadBinary<uint32_t>(seekable);
+        assert(direct == large && direct.GetCapacity() == large.GetSize());
+        if constexpr (kSimpleVectorStatsEnabled)
+            assert(direct.GetStats().allocations == 1 && direct.GetStats().regrowths == 0);
+        std::stringstream limited(out.str());
+        rejected = false;
+        try {
+            ReadBinary<uint32_t>(limited, std::allocator<uint32_t>(), 1000);
+        }
+        catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        assert(rejected);
+    }
+    {
+        const SimpleVector<char> empty;
+        std::stringstream stream;
+        WriteBinary(stream, empty);
+        assert(ReadBinary<char>(stream).IsEmpty());
+        const SimpleVector<std::byte> bytes = Serialize(empty);
+        assert(SerializedView<char>(bytes.begin(), bytes.GetSize()).IsEmpty());
+    }
+    cout << "Done!"s << endl;
+}
+
+int SumView(SimpleVectorView<const int> view) {
+    return std::accumulate(view.begin(), view.end(), 0);
+}
+
+void TestSimpleVectorView() {
+    using namespace std;
+    cout << "TestSimpleVectorView"s << endl;
+    {
+        SimpleVector<int> v{ 1, 2, 3, 4, 5 };
+        assert(SumView(v) == 15);
+        const SimpleVector<int>& cv = v;
+        assert(SumView(cv) == 15);
+
+        SimpleVectorView<int> view = v;
+        assert(view.GetSize() == 5 && view.Data() == v.begin());
+        SimpleVectorView<int> middle = view.Subview(1, 3);
+        assert(middle.GetSize() == 3 && middle[0] == 2 && middle.At(2) == 4);
+        assert(SumView(middle) == 9);
+        for (int& x : middle) {
+            x *= 10;
+        }
+        assert((v == SimpleVector<int>{ 1, 20, 30, 40, 5 }));
+        assert(view.Subview(3).GetSize() == 2);
+        assert(view.Subview(5).IsEmpty());
+        assert(view.Subview(2, 100).GetSize() == 3);
+        try {
+            view.Subview(6);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+        try {
+            middle.At(3);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+        assert((middle.ToVector() == SimpleVector<int>{ 20, 30, 40 }));
+    }
+    {
+        SimpleVector<int> a{ 1, 2, 3, 1, 2 };
+        SimpleVectorView<const int> view = a;
+        assert(view.Subview(0, 2) == view.Subview(3, 2));
+        assert(view.Subview(0, 2) != view.Subview(1, 2));
+        assert(view.Subview(0, 3) > view.Subview(3));
+        assert(view.Subview(3) < view.Subview(0, 3));
+        assert(view.Subview(3) <= view.Subview(0, 2) && view.Subview(3) >= view.Subview(0, 2));
+        assert(SimpleVectorView<const int>() == view.Subview(5));
+    }
+    {
+        int raw[] = { 3, 4 };
+        SimpleVectorView<int> empty(raw, 0);
+        SimpleVectorView<int> pair(raw, raw + 2);
+        assert(empty.IsEmpty() && pair.GetSize() == 2);
+
+        SimpleVector<int> v{ 3, 4 };
+        const SimpleVector<int>& cv = v;
+        SimpleVectorView<const int> const_view = v;
+        assert(pair == const_view && const_view == pair);
+        assert(pair == v && v == pair && cv == pair && const_view == cv);
+        assert(empty < pair && pair != empty && cv > empty);
+    }
+    {
+        SmallSimpleVector<int, 4> small{ 7, 8 };
+        assert(SumView(small) == 15);
+        const SimpleVector<std::byte> bytes = Serialize(SimpleVector<int>{ 4, 5, 6 });
+        SerializedView<int> serialized(bytes.begin(), bytes.GetSize());
+        SimpleVectorView<const int> view = serialized;
+        assert(view.Data() == serialized.begin() && SumView(view) == 15);
+        CowSimpleVector<int> cow{ 1, 1 };
+        CowSimpleVector<int> cow_copy = cow;
+        assert(SumView(cow) == 2 && cow.IsShared());
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestConcurrentSimpleVector() {
+    using namespace std;
+    cout << "TestConcurrentSimpleVector"s << endl;
+    static_assert(GeometricSegments<4>::Locate(0).segment == 0);
+    static_assert(GeometricSegments<4>::Locate(3).offset == 3);
+    static_assert(GeometricSegments<4>::Locate(4).segment == 1 && GeometricSegments<4>::Locate(4).offset == 0);
+    static_assert(GeometricSegments<4>::Locate(11).segment == 1 && GeometricSegments<4>::Locate(11).offset == 7);
+    static_assert(GeometricSegments<4>::Locate(12).segment == 2);
+    {
+        ConcurrentSimpleVector<size_t, 4> v;
+        const size_t first = v.PushBack(100);
+        const size_t* stable = &v[first];
+        const size_t threads = 4;
+        const size_t per_thread = 20'000;
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&v, t] {
+                for (size_t i = 0; i < per_thread; ++i) {
+                    v.PushBack(t * per_thread + i);
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        assert(v.GetSize() == threads * per_thread + 1);
+        assert(&v[first] == stable && *stable == 100);
+        assert(v.At(0) == 100);
+        try {
+            v.At(v.GetSize());
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+
+        SimpleVector<size_t> frozen = v.Freeze();
+        assert(v.IsEmpty());
+        assert(frozen.GetSize() == threads * per_thread + 1 && frozen.GetCapacity() == frozen.GetSize());
+        assert(frozen[0] == 100);
+        std::sort(frozen.begin() + 1, frozen.end());
+        for (size_t i = 1; i < frozen.GetSize(); ++i) {
+            assert(frozen[i] == i - 1);
+        }
+        v.PushBack(5);
+        assert(v.GetSize() == 1 && v[0] == 5);
+    }
+    //       
+    {
+        struct Picky {
+            explicit Picky(int v)
+                :value(v)
+            {
+                if (v < 0)
+                    throw std::invalid_argument("negative");
+            }
+            int value;
+        };
+        ConcurrentSimpleVector<Picky> v;
+        v.EmplaceBack(1);
+        try {
+            v.EmplaceBack(-1);
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {
+        }
+        v.EmplaceBack(2);
+        assert(v.GetSize() == 2 && v[1].value == 2);
+    }
+    {
+        ConcurrentSimpleVector<LiveCounter, 2> v;
+        for (int i = 0; i < 100; ++i) {
+            v.EmplaceBack();
+        }
+        assert(LiveCounter::alive == 100);
+    }
+    assert(LiveCounter::alive == 0);
+    //     ,    
+    {
+        ConcurrentSimpleVector<std::string, 4> v;
+        const size_t writers = 3;
+        const size_t per_writer = 5'000;
+        std::atomic<bool> done{ false };
+        std::thread reader([&v, &done] {
+            while (!done.load()) {
+                const size_t size = v.GetSize();
+                for (size_t i = size > 16 ? size - 16 : 0; i < size; ++i) {
+                    assert(v[i].size() == 40);
+                }
+            }
+        });
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < writers; ++t) {
+            workers.emplace_back([&v] {
+                for (size_t i = 0; i < per_writer; ++i) {
+                    v.PushBack(std::string(40, 'x'));
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        done = true;
+        reader.join();
+        assert(v.GetSize() == writers * per_writer);
+    }
+    //        
+    {
+        struct Pinned {
+            explicit Pinned(int v) noexcept
+                :value(v)
+            {
+            }
+            Pinned(Pinned&& other) noexcept(false)
+                :value(other.value)
+            {
+            }
+            int value;
+        };
+        ConcurrentSimpleVector<Pinned, 2> v;
+        for (int i = 0; i < 10; ++i) {
+            assert(v.EmplaceBack(i) == static_cast<size_t>(i));
+        }
+        assert(v.GetSize() == 10 && v[9].value == 9);
+        SimpleVector<Pinned> frozen = v.Freeze();
+        assert(frozen.GetSize() == 10 && frozen[4].value == 4 && v.IsEmpty());
+    }
+    // Freeze     
+    {
+        int allocations = 0;
+        {
+            ConcurrentSimpleVector<int, 4, CountingAllocator<int>> v{ CountingAllocator<int>(&allocations) };
+            for (int i = 0; i < 10; ++i) {
+                v.PushBack(i);
+            }
+            SimpleVector<int, CountingAllocator<int>> frozen = v.Freeze();
+            assert(frozen.GetSize() == 10 && frozen[9] == 9);
+            assert(frozen.GetAllocator() == CountingAllocator<int>(&allocations));
+        }
+        assert(allocations == 0);
+    }
+    cout << "Done!"s << endl;
+}
+
+void TestSegmentedSimpleVector() {
+    using namespace std;
+    cout << "TestSegmentedSimpleVector"s << endl;
+    {
+        SegmentedSimpleVector<int, 4> v;
+        v.PushBack(0);
+        int* first = &v[0];
+        for (int i = 1; i < 1000; ++i) {
+            v.PushBack(i);
+        }
+        //    
+        assert(&v[0] == first);
+        assert(v.GetSize() == 1000 && v.GetCapacity() >= 1000);
+        assert(v.GetSegmentCount() == GeometricSegments<4>::Locate(999).segment + 1);
+        for (int i = 0; i < 1000; ++i) {
+            assert(v[i] == i);
+        }
+        assert(std::accumulate(v.begin(), v.end(), 0) == 999 * 1000 / 2);
+        assert(v.end() - v.begin() == 1000);
+        assert(*(v.cbegin() + 500) == 500);
+        assert(v.At(999) == 999);
+        try {
+            v.At(1000);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+
+        v.Erase(v.begin() + 10);
+        assert(v[10] == 11 && v.GetSize() == 999);
+        v.Insert(v.begin() + 10, 10);
+        assert(v[10] == 10 && v[11] == 11 && v.GetSize() == 1000);
+
+        v.Resize(3);
+        assert(v.GetSize() == 3 && &v[0] == first);
+        v.ShrinkToFit();
+        assert(v.GetSegmentCount() == 1);
+        v.Clear();
+        v.ShrinkToFit();
+        assert(v.GetSegmentCount() == 0 && v.GetCapacity() == 0);
+    }
+    {
+        SegmentedSimpleVector<std::string, 2> a{ "a"s, "b"s, "c"s, "d"s, "e"s };
+        SegmentedSimpleVector<std::string, 2> b = a;
+        assert(a == b && !(a < b) && a <= b);
+        b[4] = "f"s;
+        assert(a != b && a < b && b > a);
+        SegmentedSimpleVector<std::string, 2> c = std::move(b);
+        assert(b.IsEmpty() && c[4] == "f"s);
+        a = c;
+        assert(a == c);
+        SegmentedSimpleVector<std::string, 2> filled(7, "x"s);
+        assert(filled.GetSize() == 7 && filled[6] == "x"s);
+        std::sort(c.begin(), c.end(), std::greater<>());
+        assert(c[0] == "f"s && c[4] == "a"s);
+    }
+    {
+        SegmentedSimpleVector<X, 4> v;
+        for (size_t i = 0; i < 20; ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(v[19].GetX() == 19);
+        v.Erase(v.begin());
+        assert(v[0].GetX() == 1);
+    }
+    {
+        SegmentedSimpleVector<LiveCounter, 4> v(50);
+        assert(LiveCounter::alive == 50);
+    }
+    assert(LiveCounter::alive == 0);
+    cout << "Done!"s << endl;
+}
+
+void TestSoaVector() {
+    using namespace std;
+    cout << "TestSoaVector"s << endl;
+    // :  x, y  
+    enum ParticleField { kX, kY, kName };
+    {
+        SoaVector<float, float, std::string> particles;
+        assert(particles.IsEmpty() && particles.kFieldCount == 3);
+        for (int i = 0; i < 100; ++i) {
+            particles.PushBack(static_cast<float>(i), static_cast<float>(-i), "p"s + std::to_string(i));
+        }
+        assert(particles.GetSize() == 100 && particles.GetCapacity() >= 100);
+
+        SimpleVectorView<float> xs = particles.Column<kX>();
+        assert(xs.GetSize() == 100);
+        assert(std::accumulate(xs.begin(), xs.end(), 0.0f) == 4950.0f);
+        for (float& y : particles.Column<kY>()) {
+            y *= 2;
+        }
+        assert(particles.Get<kY>(10) == -20.0f);
+        assert(particles.Get<kName>(42) == "p42"s);
+
+        auto [x, y, name] = particles.Row(7);
+        assert(x == 7.0f && y == -14.0f && name == "p7"s);
+        std::get<kX>(particles.At(7)) = 70.0f;
+        assert(particles.Get<kX>(7) == 70.0f);
+        try {
+            particles.At(100);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+
+        const float* before = particles.Column<kX>().Data();
+        particles.Reserve(1000);
+        assert(particles.GetCapacity() == 1000 && particles.Column<kX>().Data() != before);
+        assert(particles.Get<kName>(99) == "p99"s);
+
+        SoaVector<float, float, std::string> copy = particles;
+        assert(copy.GetSize() == 100 && copy.Get<kName>(5) == "p5"s);
+        particles.Resize(10);
+        assert(particles.GetSize() == 10 && copy.GetSize() == 100);
+        particles.Resize(20);
+        assert(particles.Get<kName>(15).empty() && particles.Get<kX>(15) == 0.0f);
+        particles.PopBack();
+        assert(particles.GetSize() == 19);
+
+        const SoaVector<float, float, std::string> moved = std::move(copy);
+        assert(copy.IsEmpty() && moved.GetSize() == 100);
+        assert(moved.Column<kY>()[3] == -6.0f);
+        particles.Clear();
+        assert(particles.IsEmpty());
+    }
+    {
+        SoaVector<int, LiveCounter> v(10);
+        assert(LiveCounter::alive == 10);
+        v.PushBack(1, LiveCounter());
+        assert(LiveCounter::alive == 11);
+    }
+    assert(LiveCounter::alive == 0);
+    //            
+    {
+        SoaVector<LiveCounter, std::string, ParallelThrower> v;
+        const std::string long_text(40, 'q');
+        v.PushBack(LiveCounter(), long_text, ParallelThrower(1));
+        v.PushBack(LiveCounter(), long_text, ParallelThrower(2));
+        assert(v.GetCapacity() == 2);
+        v.Column<2>()[1].value = -1;
+        try {
+            v.PushBack(LiveCounter(), long_text, ParallelThrower(3));
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v.GetSize() == 2 && v.GetCapacity() == 2);
+        assert(LiveCounter::alive == 2 && ParallelThrower::alive == 2);
+        assert(v.Column<1>()[0] == long_text && v.Column<1>()[1] == long_text);
+        v.Column<2>()[1].value = 2;
+        v.PushBack(LiveCounter(), long_text, ParallelThrower(3));
+        assert(v.GetSize() == 3 && v.Column<2>()[2].value == 3 && v.Column<1>()[2] == long_text);
+    }
+    assert(LiveCounter::alive == 0 && ParallelThrower::alive == 0);
+    cout << "Done!"s << endl;
+}
+
+//  ,    
+constexpr StaticSimpleVector<int, 16> MakeSquares(int count) {
+    StaticSimpleVector<int, 16> squares;
+    for (int i = 0; i < count; ++i) {
+        squares.PushBack(i * i);
+    }
+    return squares;
+}
+
+constexpr int StaticInsertErase() {
+    StaticSimpleVector<int, 8> v{ 1, 2, 4 };
+    v.Insert(v.begin() + 2, 3);
+    v.Insert(v.begin(), v[3]);
+    v.Erase(v.begin() + 1);
+    //  4 2 3 4
+    return v[0] * 1000 + v[1] * 100 + v[2] * 10 + v[3] + (v.TryPushBack(5) ? 0 : 1) * 100000;
+}
+
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+//         SimpleVector
+struct ConstexprValue {
+    constexpr ConstexprValue(int v = 0)
+        :value(v)
+    {
+    }
+
+    constexpr ConstexprValue(const ConstexprValue& other)
+        :value(other.value)
+    {
+    }
+
+    constexpr ConstexprValue& operator=(const ConstexprValue& other) {
+        value = other.value;
+        return *this;
+    }
+
+    int value;
+};
+
+constexpr int SimpleVectorInConstexpr() {
+    SimpleVector<int> v;
+    for (int i = 0; i < 10; ++i) {
+        v.PushBack(i);
+    }
+    v.Insert(v.begin() + 3, 100);
+    v.Insert(v.begin(), v[5]);
+    v.Erase(v.begin() + 1);
+    v.EraseIf([](int value) { return value % 2 == 1; });
+    SimpleVector<int> copy(v);
+    copy.Reserve(100);
+    copy.ShrinkToFit();
+    if (!(copy == v) || copy < v)
+        return -1;
+    int sum = 0;
+    for (int value : copy) {
+        sum += value;
+    }
+    return sum;
+}
+
+constexpr int NonTrivialInConstexpr() {
+    SimpleVector<ConstexprValue> v(3, ConstexprValue(7));
+    v.Insert(v.begin() + 1, ConstexprValue(1));
+    v.Insert(v.begin(), v[1]);
+    v.PushBack(ConstexprValue(2));
+    v.Erase(v.begin() + 2);
+    int result = 0;
+    for (const ConstexprValue& item : v) {
+        result = result * 10 + item.value;
+    }
+    return result;
+}
+#endif
+
+void TestConstexpr() {
+    using namespace std;
+    cout << "TestConstexpr"s << endl;
+    {
+        constexpr auto squares = MakeSquares(10);
+        static_assert(squares.GetSize() == 10);
+        static_assert(squares[9] == 81);
+        static_assert(StaticSimpleVector<int, 16>::GetCapacity() == 16);
+        static_assert(StaticInsertErase() == 4234);
+        static_assert(std::is_trivially_destructible_v<StaticSimpleVector<int, 16>>);
+    }
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+    {
+        //     4 2 100 4 6 8
+        static_assert(SimpleVectorInConstexpr() == 124);
+        static_assert(NonTrivialInConstexpr() == 17772);
+        static_assert(MakeSquares(4) == StaticSimpleVector<int, 16>{ 0, 1, 4, 9 });
+        static_assert(MakeSquares(3) < MakeSquares(4));
+    }
+#endif
+    {
+        StaticSimpleVector<std::string, 4> v{ "a"s, "b"s };
+        v.Insert(v.begin(), v[1]);
+        assert(v.GetSize() == 3 && v[0] == "b"s && v[1] == "a"s && v[2] == "b"s);
+        v.Erase(v.begin() + 1);
+        v.PushBack("c"s);
+        v.EmplaceBack(3, 'd');
+        assert(v.IsFull());
+        assert(!v.TryPushBack("e"s));
+        try {
+            v.PushBack("e"s);
+            assert(false);
+        }
+        catch (const std::length_error&) {
+        }
+        catch (...) {
+            assert(false);
+        }
+        StaticSimpleVector<std::string, 4> copy(v);
+        assert(copy == v);
+        StaticSimpleVector<std::string, 4> moved(std::move(copy));
+        assert(moved == v && copy.IsEmpty());
+        moved.PopBack();
+        assert(moved < v);
+        copy = moved;
+        assert(copy == moved);
+        moved = std::move(v);
+        assert(moved.GetSize() == 4 && moved[3] == "ddd"s && v.IsEmpty());
+        try {
+            moved.At(4);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+        catch (...) {
+            assert(false);
+        }
+    }
+    {
+        StaticSimpleVector<LiveCounter, 8> v(5);
+        assert(LiveCounter::alive == 5);
+        v.Resize(2);
+        assert(LiveCounter::alive == 2);
+        v.Insert(v.begin(), LiveCounter());
+        assert(LiveCounter::alive == 3);
+        v.Clear();
+        assert(LiveCounter::alive == 0);
+        v.Resize(8);
+        try {
+            v.Resize(9);
+            assert(false);
+        }
+        catch (const std::length_error&) {
+        }
+        assert(LiveCounter::alive == 8);
+    }
+    assert(LiveCounter::alive == 0);
+    cout << "Done!"s << endl;
+}
+
+void TestFlatContainers() {
+    using namespace std;
+    cout << "TestFlatContainers"s << endl;
+    {
+        //       std::lower_bound     
+        SimpleVector<int> sorted;
+        for (int i = 0; i < 40; ++i) {
+            sorted.PushBack(i / 3 * 2);
+        }
+        for (size_t count = 0; count <= sorted.GetSize(); ++count) {
+            for (int key = -1; key < 30; ++key) {
+                const int* expected = std::lower_bound(sorted.begin(), sorted.begin() + count, key);
+                assert(BranchlessLowerBound(sorted.cbegin(), count, key, std::less<int>()) == expected);
+            }
+        }
+    }
+    {
+        FlatSet<int> set{ 5, 1, 4, 1, 3, 9, 5 };
+        assert(set.GetSize() == 5);
+        assert(std::is_sorted(set.begin(), set.end()));
+        assert(set.Contains(4) && !set.Contains(2));
+        assert(set.Count(9) == 1 && set.Count(0) == 0);
+        assert(*set.LowerBound(2) == 3 && *set.UpperBound(4) == 5 && set.UpperBound(9) == set.end());
+        assert(set.Insert(2).second);
+        assert(!set.Insert(2).second);
+        assert(*set.Insert(2).first == 2);
+        assert(set.Erase(4) == 1 && set.Erase(4) == 0);
+        assert(*set.Erase(set.Find(1)) == 2);
+
+        const int more[] = { 8, 0, 3, 7, 0 };
+        set.InsertRange(std::begin(more), std::end(more));
+        const FlatSet<int> expected{ 0, 2, 3, 5, 7, 8, 9 };
+        assert(set == expected);
+        assert(set.EraseIf([](int key) { return key % 2 == 1; }) == 4);
+        assert(set == (FlatSet<int>{ 0, 2, 8 }));
+
+        SimpleVector<int> keys = set.Extract();
+        assert(set.IsEmpty() && keys.GetSize() == 3 && keys[2] == 8);
+        FlatSet<int> adopted(kSortedUnique, std::move(keys));
+        assert(adopted.Contains(8));
+    }
+    {
+        FlatSet<std::string, std::greater<std::string>> words(SimpleVector<std::string>{ "b"s, "c"s, "a"s, "b"s });
+        assert(words.GetSize() == 3 && *words.begin() == "c"s);
+        words.Insert("d"s);
+        assert(*words.begin() == "d"s);
+    }
+    {
+        FlatMap<std::string, int> map{ { "one"s, 1 }, { "three"s, 3 }, { "two"s, 2 }, { "one"s, 100 } };
+        assert(map.GetSize() == 3);
+        assert(map.At("one"s) == 1);
+        assert(map["two"s] == 2);
+        map["four"s] = 4;
+        assert(map.GetSize() == 4 && map.At("four"s) == 4);
+        assert(!map.TryEmplace("four"s, 40).second);
+        assert(map.InsertOrAssign("four"s, 44).first->second == 44);
+        assert(map.Insert({ "five"s, 5 }).second);
+        assert(!map.Insert({ "five"s, 50 }).second);
+        map.Find("three"s)->second = 33;
+        assert(std::as_const(map).Find("three"s)->second == 33);
+        assert(map.Find("zero"s) == map.end());
+        assert(std::is_sorted(map.begin(), map.end()));
+        try {
+            map.At("zero"s);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+        catch (...) {
+            assert(false);
+        }
+
+        //         
+        SimpleVector<std::pair<std::string, int>> batch;
+        batch.PushBack({ "six"s, 6 });
+        batch.PushBack({ "one"s, -1 });
+        batch.PushBack({ "seven"s, 7 });
+        map.InsertRange(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+        assert(map.GetSize() == 7 && map.At("one"s) == 1 && map.At("seven"s) == 7);
+
+        assert(map.Erase("two"s) == 1);
+        map.Erase(map.Find("six"s));
+        assert(map.GetSize() == 5 && !map.Contains("six"s));
+        FlatMap<std::string, int> copy = map;
+        assert(copy == map);
+        copy["two"s];
+        assert(copy != map);
+    }
+    {
+        FlatMap<int, LiveCounter> map;
+        map[3];
+        map[1];
+        map.TryEmplace(2);
+        assert(LiveCounter::alive == 3);
+        map.EraseIf([](const std::pair<int, LiveCounter>& item) { return item.first != 2; });
+        assert(LiveCounter::alive == 1);
+    }
+    assert(LiveCounter::alive == 0);
+    cout << "Done!"s << endl;
+}
+
+void TestPackedBools() {
+    using namespace std;
+    cout << "TestPackedBools"s << endl;
+    {
+        SimpleVector<bool> flags;
+        for (size_t i = 0; i < 200; ++i) {
+            flags.PushBack(i % 3 == 0);
+        }
+        assert(flags.GetSize() == 200 && flags.GetWordCount() == 4);
+        assert(flags.GetCapacity() >= 200 && flags.GetCapacity() % 64 == 0);
+        assert(flags[0] && !flags[1] && flags[198] && !flags[199]);
+        assert(flags.Count() == 67);
+        assert(flags.FindFirst() == 0 && flags.FindNext(0) == 3 && flags.FindNext(198) == flags.kNotFound);
+
+        flags[1] = true;
+        flags[0] = flags[2];
+        flags[5].Flip();
+        assert(!flags[0] && flags[1] && !flags[2] && flags[5]);
+        flags[5].Flip();
+        assert(flags.At(199) == false);
+        try {
+            flags.At(200);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+        catch (...) {
+            assert(false);
+        }
+
+        size_t visited = 0;
+        for (size_t index = flags.FindFirst(); index != flags.kNotFound; index = flags.FindNext(index)) {
+            assert(flags[index]);
+            ++visited;
+        }
+        assert(visited == flags.Count());
+        assert(static_cast<size_t>(std::count(flags.cbegin(), flags.cend(), true)) == visited);
+
+        flags.PopBack();
+        flags.PopBack();
+        assert(flags.GetSize() == 198 && flags.FindNext(195) == flags.kNotFound);
+        flags.Resize(300, true);
+        assert(flags.Count() == visited - 1 + 102 && !flags[197] && flags[198] && flags[299]);
+        flags.Resize(100);
+        flags.Resize(130);
+        assert(!flags[100] && !flags[129]);
+        const size_t set = flags.Count();
+        flags.FlipAll();
+        assert(flags.Count() == 130 - set && flags[100] && flags.FindNext(129) == flags.kNotFound);
+    }
+    {
+        SimpleVector<bool> a(130, false);
+        SimpleVector<bool> b(130, true);
+        assert(a.Count() == 0 && b.Count() == 130 && !a.Any() && b.Any());
+        a[3] = true;
+        a[129] = true;
+        b[3] = false;
+        assert((a & b).Count() == 1 && (a & b).FindFirst() == 129);
+        assert((a | b).Count() == 130);
+        assert((a ^ b).Count() == 129 && !(a ^ b)[129]);
+        a ^= a;
+        assert(a.Count() == 0);
+        b.Fill(false);
+        assert(a == b);
+        SimpleVector<bool> c(10);
+        try {
+            a &= c;
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {
+        }
+        catch (...) {
+            assert(false);
+        }
+    }
+    {
+        //     
+        const SimpleVector<bool> x{ true, false, true };
+        const SimpleVector<bool> y{ true, true };
+        const SimpleVector<bool> z{ true, false };
+        assert(x < y && z < x && !(y < x) && x != z && x == SimpleVector<bool>({ true, false, true }));
+        SimpleVector<bool> long_x(100, false);
+        SimpleVector<bool> long_y(100, false);
+        long_x[70] = true;
+        long_y[80] = true;
+        assert(long_y < long_x && long_x > long_y);
+        long_y[70] = true;
+        assert(long_x < long_y);
+        assert(std::lexicographical_compare(long_x.begin(), long_x.end(), long_y.begin(), long_y.end()));
+
+        SimpleVector<bool> copy(long_y);
+        SimpleVector<bool> moved(std::move(copy));
+        assert(moved == long_y && copy.IsEmpty());
+        copy = moved;
+        moved.ShrinkToFit();
+        assert(copy == moved && moved.GetCapacity() == 128);
+        static_assert(sizeof(SimpleVector<bool>) <= sizeof(SimpleVector<int>));
+    }
+    //         std::vector<bool>
+    {
+        std::vector<bool> expected;
+        for (size_t i = 0; i < 150; ++i) {
+            expected.push_back(i % 5 == 1 || i % 7 == 0);
+        }
+        SimpleVector<bool> flags(expected.begin(), expected.end());
+        assert(flags.GetCapacity() == 192);
+        auto check = [&flags, &expected] {
+            assert(flags.GetSize() == expected.size());
+            assert(std::equal(flags.begin(), flags.end(), expected.begin()));
+            assert(flags.Count() == static_cast<size_t>(std::count(expected.begin(), expected.end(), true)));
+        };
+        check();
+        assert(*flags.Insert(flags.begin() + 3, true));
+        expected.insert(expected.begin() + 3, true);
+        flags.Emplace(flags.begin() + 64, false);
+        expected.insert(expected.begin() + 64, false);
+        flags.Insert(flags.end(), true);
+        expected.push_back(true);
+        check();
+        const bool pattern[] = { true, true, false, true, false, false, true };
+        for (size_t i = 0; i < 20; ++i) {
+            flags.InsertRange(flags.begin() + 61, std::begin(pattern), std::end(pattern));
+            expected.insert(expected.begin() + 61, std::begin(pattern), std::end(pattern));
+        }
+        check();
+        //     
+        flags.InsertRange(flags.begin() + 5, flags.cbegin() + 100, flags.cbegin() + 230);
+        const std::vector<bool> part(expected.begin() + 100, expected.begin() + 230);
+        expected.insert(expected.begin() + 5, part.begin(), part.end());
+        check();
+        assert(flags.Erase(flags.begin() + 10, flags.begin() + 150) == flags.begin() + 10);
+        expected.erase(expected.begin() + 10, expected.begin() + 150);
+        flags.Erase(flags.begin());
+        expected.erase(expected.begin());
+        check();
+        flags.SwapErase(flags.begin() + 2);
+        expected[2] = expected.back();
+        expected.pop_back();
+        check();
+        assert(flags.EmplaceBack(1) && flags.EmplaceBack() == false);
+        expected.push_back(true);
+        expected.push_back(false);
+        check();
+        const size_t removed = flags.EraseIf([](bool value) { return value; });
+        assert(removed == static_cast<size_t>(std::count(expected.begin(), expected.end(), true)));
+        assert(flags.Count() == 0 && flags.GetSize() == expected.size() - removed);
+
+        const size_t capacity = flags.GetCapacity();
+        flags.Assign(std::begin(pattern), std::end(pattern));
+        assert(flags.GetCapacity() == capacity && flags == SimpleVector<bool>(std::begin(pattern), std::end(pattern)));
+        std::istringstream input("1 0 1 1");
+        flags.Assign(std::istream_iterator<int>(input), std::istream_iterator<int>());
+        assert((flags == SimpleVector<bool>{ true, false, true, true }));
+        flags.Append(std::begin(pattern), std::begin(pattern) + 2);
+        assert(flags.GetSize() == 6 && flags[4] && flags[5]);
+    }
+    {
+        SimpleVector<bool> flags{ true };
+        {
+            SimpleVector<bool>::BackInserter writer(flags, 16);
+            for (size_t i = 0; i < 300; ++i) {
+                writer.PushBack(i % 2 == 0);
+            }
+            writer.Emplace(1).Flip();
+            assert(writer.GetPending() > 0 && flags.GetSize() < 302);
+        }
+        assert(flags.GetSize() == 302 && flags.Count() == 151 && !flags[301] && flags[299]);
+    }
+    cout << "Done!"s << endl;
+}
+
+//    .    noexcept,   
+struct CopyOrMove {
+    CopyOrMove(int v = 0)
+        :value(v)
+    {
+    }
+    CopyOrMove(const CopyOrMove& other)
+        :value(other.value)
+    {
+        if (copies_until_throw > 0 && --copies_until_throw == 0)
+            throw std::runtime_error("copy failed");
+        ++copies;
+    }
+    CopyOrMove(CopyOrMove&& other)
+        :value(other.value)
+    {
+        other.value = -1;
+        ++moves;
+    }
+    CopyOrMove& operator=(const CopyOrMove& other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+    CopyOrMove& operator=(CopyOrMove&& other) {
+        value = other.value;
+        other.value = -1;
+        ++moves;
+        return *this;
+    }
+
+    static void Reset() {
+        copies = 0;
+        moves = 0;
+        copies_until_throw = 0;
+    }
+
+    int value;
+    static inline size_t copies = 0;
+    static inline size_t moves = 0;
+    static inline size_t copies_until_throw = 0;
+};
+
+// ,         
+struct NothrowMoveCounter {
+    NothrowMoveCounter(int v = 0)
+        :value(v)
+    {
+    }
+    NothrowMoveCounter(const NothrowMoveCounter& other)
+        :value(other.value)
+    {
+        ++copies;
+    }
+    NothrowMoveCounter(NothrowMoveCounter&& other) noexcept = default;
+    NothrowMoveCounter& operator=(const NothrowMoveCounter& other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+    NothrowMoveCounter& operator=(NothrowMoveCounter&& other) noexcept = default;
+
+    std::string value_text = "a long string that defeats the small string optimization";
+    int value;
+    static inline size_t copies = 0;
+};
+
+void TestRelocationGuarantees() {
+    using namespace std;
+    cout << "TestRelocationGuarantees"s << endl;
+    static_assert(IsMovedOnRelocationV<std::string>);
+    static_assert(!IsMovedOnRelocationV<CopyOrMove>);
+    static_assert(IsMovedOnRelocationV<std::unique_ptr<int>>);
+    {
+        //   :    ,      
+        SimpleVector<CopyOrMove> v;
+        v.Reserve(4);
+        for (int i = 0; i < 4; ++i) {
+            v.PushBack(CopyOrMove(i));
+        }
+        CopyOrMove::Reset();
+        v.Reserve(8);
+        assert(CopyOrMove::copies == 4 && CopyOrMove::moves == 0);
+        assert(v.GetCapacity() == 8 && v[3].value == 3);
+
+        v.ShrinkToFit();
+        CopyOrMove::Reset();
+        CopyOrMove::copies_until_throw = 3;
+        try {
+            v.Reserve(100);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v.GetSize() == 4 && v.GetCapacity() == 4);
+        for (int i = 0; i < 4; ++i) {
+            assert(v[i].value == i);
+        }
+
+        CopyOrMove::Reset();
+        CopyOrMove::copies_until_throw = 2;
+        try {
+            v.PushBack(CopyOrMove(4));
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v.GetSize() == 4 && v.GetCapacity() == 4 && v[0].value == 0 && v[3].value == 3);
+        CopyOrMove::Reset();
+    }
+    {
+        //   :         
+        SimpleVector<NothrowMoveCounter> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(NothrowMoveCounter(i));
+        }
+        NothrowMoveCounter::copies = 0;
+        v.Reserve(v.GetCapacity() * 4);
+        assert(NothrowMoveCounter::copies == 0);
+        const NothrowMoveCounter value(100);
+        v.Insert(v.begin() + 1, value);
+        assert(NothrowMoveCounter::copies == 1);
+        v.ShrinkToFit();
+        v.Insert(v.begin() + 2, value);
+        assert(NothrowMoveCounter::copies == 2);
+        assert(v[0].value == 0 && v[1].value == 100 && v[2].value == 100 && v[3].value == 1 && v[11].value == 9);
+    }
+    {
+        //       ,     
+        SimpleVector<std::string> v{ "a"s, "b"s, "c"s };
+        v.Reserve(10);
+        v.Insert(v.begin(), v[1]);
+        assert((v == SimpleVector<std::string>{ "b"s, "a"s, "b"s, "c"s }));
+        v.ShrinkToFit();
+        v.Insert(v.begin() + 1, v[3]);
+        assert((v == SimpleVector<std::string>{ "b"s, "c"s, "a"s, "b"s, "c"s }));
+        v.Insert(v.end(), v[0]);
+        assert(v.GetSize() == 6 && v[5] == "b"s);
+    }
+    {
+        //  SmallSimpleVector       :
+        //   -1  ,    
+        SmallSimpleVector<ParallelThrower, 2> v;
+        v.EmplaceBack(1);
+        v.EmplaceBack(-1);
+        for (size_t index : { 0, 1, 2 }) {
+            try {
+                v.Emplace(v.begin() + index, 5);
+                assert(false);
+            }
+            catch (const runtime_error&) {
+            }
+            assert(v.IsInline() && v.GetSize() == 2 && v[0].value == 1 && v[1].value == -1);
+        }
+        assert(ParallelThrower::alive == 2);
+    }
+    {
+        //      Growth
+        SmallSimpleVector<int, 2, std::allocator<int>, GrowthOneAndHalf> v{ 1, 2 };
+        v.PushBack(3);
+        assert(v.GetCapacity() == 4);
+        v.Resize(5);
+        assert(v.GetCapacity() == 7);
+    }
+    {
+        //             
+        struct ThrowingAssign : LiveCounter {
+            explicit ThrowingAssign(int v)
+                :value(v)
+            {
+            }
+            ThrowingAssign(ThrowingAssign&&) = default;
+            ThrowingAssign& operator=(ThrowingAssign&& other) {
+                if (other.value < 0)
+                    throw std::runtime_error("assign failed");
+                value = other.value;
+                return *this;
+            }
+            int value;
+        };
+        SimpleVector<ThrowingAssign> v;
+        v.Reserve(4);
+        for (int i = 0; i < 3; ++i) {
+            v.EmplaceBack(i);
+        }
+        try {
+            v.Emplace(v.begin() + 1, -1);
+            assert(false);
+        }
+        catch (const runtime_error&) {
+        }
+        assert(v.GetSize() == 4u && LiveCounter::alive == 4);
+    }
+    assert(LiveCounter::alive == 0);
+    cout << "Done!"s << endl;
+}
+
+void TestBackInserter() {
+    using namespace std;
+    cout << "TestBackInserter"s << endl;
+    {
+        //    ,     
+        SimpleVector<int> v{ 1, 2 };
+        {
+            SimpleVector<int>::BackInserter writer(v, 16, 8);
+            for (int i = 0; i < 1000; ++i) {
+                writer.PushBack(i);
+                assert(v.GetSize() + writer.GetPending() == 3u + i);
+            }
+            assert(v.GetSize() < 1002u);
+            writer.Commit();
+            assert(v.GetSize() == 1002u && writer.GetPending() == 0);
+            assert(writer.Emplace(-1) == -1);
+        }
+        assert(v.GetSize() == 1003u && v[0] == 1 && v[2] == 0 && v[1001] == 999 && v[1002] == -1);
+    }
+    {
+        //    ,      chunk
+        SimpleVector<uint8_t> bytes;
+        {
+            SimpleVector<uint8_t>::BackInserter writer(bytes, 4);
+            const char text[] = "streaming ingest";
+            memcpy(writer.Claim(9), text, 9);
+            *writer.Claim(1) = '!';
+        }
+        assert(bytes.GetSize() == 10u && bytes.GetCapacity() >= 10u);
+        assert(string(bytes.begin(), bytes.end()) == "streaming!"s);
+    }
+    {
+        //      ,    
+        SimpleVector<string> words;
+        {
+            SimpleVector<string>::BackInserter writer(words, 2);
+            for (int i = 0; i < 50; ++i) {
+                writer.Emplace(to_string(i) + " and some text to escape SSO"s);
+            }
+        }
+        assert(words.GetSize() == 50u && words[49] == "49 and some text to escape SSO"s);
+    }
+    {
+        //       
+        SimpleVector<ParallelThrower> v;
+        try {
+            SimpleVector<ParallelThrower>::BackInserter writer(v);
+            const ParallelThrower ok(1);
+            const ParallelThrower bad(-1);
+            for (int i = 0; i < 5; ++i) {
+                writer.PushBack(ok);
+            }
+            writer.PushBack(bad);
+            assert(false);
+        }
+        catch (const runtime_error&) {
+        }
+        assert(v.GetSize() == 5u && v[4].value == 1);
+    }
+    assert(ParallelThrower::alive == 0);
+    cout << "Done!"s << endl;
+}
+
+void TestBufferQueue() {
+    using namespace std;
+    cout << "TestBufferQueue"s << endl;
+    {
+        BufferQueue<uint8_t> queue(3, 4096);
+        assert(queue.GetBufferCount() == 3u && queue.GetBufferCapacity() == 4096u);
+        //          
+        vector<SimpleVector<uint8_t>> initial;
+        vector<const uint8_t*> blocks;
+        for (int i = 0; i < 3; ++i) {
+            initial.push_back(queue.Acquire());
+            assert(initial.back().IsEmpty() && initial.back().GetCapacity() == 4096u);
+            blocks.push_back(initial.back().begin());
+        }
+        for (SimpleVector<uint8_t>& buffer : initial) {
+            queue.Release(move(buffer));
+        }
+
+        constexpr int kBuffers = 200;
+        thread producer([&queue] {
+            for (int i = 0; i < kBuffers; ++i) {
+                SimpleVector<uint8_t> buffer = queue.Acquire();
+                buffer.Resize(1000);
+                fill(buffer.begin(), buffer.end(), static_cast<uint8_t>(i));
+                queue.Publish(move(buffer));
+                assert(buffer.GetCapacity() == 0u);
+            }
+            queue.Close();
+        });
+        int consumed = 0;
+        bool recycled = true;
+        while (optional<SimpleVector<uint8_t>> buffer = queue.Consume()) {
+            assert(buffer->GetSize() == 1000u && (*buffer)[999] == static_cast<uint8_t>(consumed));
+            recycled = recycled && find(blocks.begin(), blocks.end(), buffer->begin()) != blocks.end();
+            ++consumed;
+            queue.Release(move(*buffer));
+        }
+        producer.join();
+        assert(consumed == kBuffers && recycled && queue.IsClosed());
+        assert(!queue.Consume());
+    }
+    {
+        BufferQueue<int> queue(1, 8);
+        SimpleVector<int> buffer;
+        assert(queue.TryAcquire(buffer) && !queue.TryAcquire(buffer));
+        buffer.PushBack(42);
+        SimpleVector<int> stranger{ 1 };
+        queue.Publish(move(buffer));
+        try {
+            //      
+            queue.Publish(move(stranger));
+            assert(false);
+        }
+        catch (const logic_error&) {
+        }
+        SimpleVector<int> taken;
+        assert(queue.TryConsume(taken) && taken[0] == 42 && !queue.TryConsume(taken));
+        queue.Release(move(taken));
+    }
+    try {
+        BufferQueue<int> empty(0, 8);
+        assert(false);
+    }
+    catch (const invalid_argument&) {
+    }
+    cout << "Done!"s << endl;
+}
+
+#if SIMPLE_VECTOR_HAS_COROUTINES
+// ,       ;    
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() noexcept {
+            return {};
+        }
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() noexcept {
+        }
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+DetachedTask ConsumeBuffers(BufferQueue<int>& queue, SimpleVector<int>& sums, bool& finished) {
+    while (std::optional<SimpleVector<int>> buffer = co_await queue.ConsumeAsync()) {
+        sums.PushBack(std::accumulate(buffer->begin(), buffer->end(), 0));
+        queue.Release(std::move(*buffer));
+    }
+    finished = true;
+}
+
+DetachedTask ProduceBuffer(BufferQueue<int>& queue, int value) {
+    SimpleVector<int> buffer = co_await queue.AcquireAsync();
+    buffer.Resize(4);
+    std::fill(buffer.begin(), buffer.end(), value);
+    queue.Publish(std::move(buffer));
+}
+
+void TestBufferQueueCoroutines() {
+    using namespace std;
+    cout << "TestBufferQueueCoroutines"s << endl;
+    BufferQueue<int> queue(1, 16);
+    SimpleVector<int> sums;
+    bool finished = false;
+    //         Publish
+    ConsumeBuffers(queue, sums, finished);
+    assert(sums.IsEmpty());
+    SimpleVector<int> held = queue.Acquire();
+    //   ,     
+    ProduceBuffer(queue, 1);
+    ProduceBuffer(queue, 2);
+    held.PushBack(10);
+    queue.Publish(move(held));
+    // Release      ,  Publish      
+    assert((sums == SimpleVector<int>{ 10, 4, 8 }));
+    assert(!finished);
+    queue.Close();
+    assert(finished);
+    cout << "Done!"s << endl;
+}
+#endif
+
+void TestPooledAllocator() {
+    using namespace std;
+    cout << "TestPooledAllocator"s << endl;
+    using PooledVector = SimpleVector<int, PooledAllocator<int>>;
+    ThreadBufferPool::Trim();
+    SimpleVectorStatsRegistry::Reset();
+    {
+        //        
+        const int* first = nullptr;
+        for (int i = 0; i < 10; ++i) {
+            PooledVector v(Reserve(100 + i));
+            v.PushBack(i);
+            if (!first)
+                first = v.begin();
+            assert(v.begin() == first && v[0] == i);
+        }
+        const SimpleVectorStats stats = SimpleVectorStatsRegistry::Snapshot();
+        if constexpr (kSimpleVectorStatsEnabled)
+            assert(stats.pool_misses == 1 && stats.pool_hits == 9);
+        else
+            assert(stats.pool_misses == 0 && stats.pool_hits == 0);
+        assert(ThreadBufferPool::GetCachedBytes() == 512u);
+    }
+    {
+        // ,    PushBack,     
+        for (int round = 0; round < 2; ++round) {
+            SimpleVectorStatsRegistry::Reset();
+            PooledVector v;
+            for (int i = 0; i < 1000; ++i) {
+                v.PushBack(i);
+            }
+            assert(v.GetSize() == 1000u && v[999] == 999);
+            if constexpr (kSimpleVectorStatsEnabled) {
+                const SimpleVectorStats stats = SimpleVectorStatsRegistry::Snapshot();
+                assert(round == 0 || stats.pool_misses == 0);
+            }
+        }
+    }
+    {
+        // ,    ,     
+        PooledVector v{ 1, 2, 3 };
+        const size_t cached = ThreadBufferPool::GetCachedBytes();
+        thread([&v] {
+            PooledVector local(std::move(v));
+            assert(local[2] == 3);
+        }).join();
+        assert(ThreadBufferPool::GetCachedBytes() == cached);
+    }
+    ThreadBufferPool::Trim();
+    assert(ThreadBufferPool::GetCachedBytes() == 0u);
+    assert(PooledAllocator<int>() == PooledAllocator<double>());
+    cout << "Done!"s << endl;
+}
+
+#if defined(__linux__)
+void TestHugePageAllocator() {
+    using namespace std;
+    cout << "TestHugePageAllocator"s << endl;
+    using HugeVector = SimpleVector<double, HugePageAllocator<double>>;
+    const auto is_huge_aligned = [](const void* ptr) {
+        return reinterpret_cast<uintptr_t>(ptr) % kHugePageSize == 0;
+    };
+    {
+        //    reallocate:    mremap     
+        HugeVector v;
+        for (int i = 0; i < 600'000; ++i) {
+            v.PushBack(i);
+        }
+        assert(is_huge_aligned(v.begin()));
+        for (int i = 0; i < 600'000; ++i) {
+            assert(v[i] == i);
+        }
+        v.Resize(1000);
+        v.ShrinkToFit();
+        assert(v.GetCapacity() == 1000 && v[999] == 999.0);
+    }
+    {
+        //  hugetlbfs   ,      
+        const HugePageAllocator<int> alloc(MemoryPlacement{ HugePages::kExplicit });
+        SimpleVector<int, HugePageAllocator<int>> v(100, 7, alloc);
+        assert(v.GetAllocator() == alloc && v[99] == 7);
+        SimpleVector<int, HugePageAllocator<int>> copy(v);
+        assert(copy == v && copy.GetAllocator().GetPlacement().huge_pages == HugePages::kExplicit);
+
+        const HugePageAllocator<char> small(MemoryPlacement{ HugePages::kNone });
+        assert(HugePageAllocator<int>(small) == small && small != alloc);
+        SimpleVector<char, HugePageAllocator<char>> bytes(10, 'x', small);
+        assert(reinterpret_cast<uintptr_t>(bytes.begin()) % static_cast<uintptr_t>(sysconf(_SC_PAGESIZE)) == 0);
+    }
+    {
+        //  0  ;   ,      
+        const HugePageAllocator<double> alloc(MemoryPlacement{ HugePages::kTransparent, NumaPolicy::kInterleave, 1 });
+        const Parallel policy{ 10'000, 4 };
+        HugeVector v(500'000, 2.5, policy, alloc);
+        assert(std::all_of(v.begin(), v.end(), [](double value) { return value == 2.5; }));
+        HugeVector bound(HugePageAllocator<double>(MemoryPlacement{ HugePages::kTransparent, NumaPolicy::kBind, 1 }));
+        bound.PushBack(1.0);
+        assert(bound[0] == 1.0);
+        try {
+            //    63  
+            HugeVector missing(10, HugePageAllocator<double>(MemoryPlacement{ HugePages::kNone, NumaPolicy::kBind, 1ul << 63 }));
+            assert(false);
+        }
+        catch (const std::system_error&) {
+        }
+    }
+    {
+        HugeVector v(Reserve(300'000));
+        ParallelFirstTouch(v.begin(), v.GetCapacity(), Parallel{ 10'000, 4 }, v.GetAllocator().GetPlacement());
+        v.Resize(300'000);
+        assert(v.GetCapacity() == 300'000 && v[299'999] == 0.0);
+    }
+    {
+        HugeVector v(Reserve(100'000), HugePageAllocator<double>(MemoryPlacement{ HugePages::kNone }));
+        ParallelFirstTouch(v.begin(), v.GetCapacity(), Parallel{ 1'000, 4 }, v.GetAllocator().GetPlacement());
+        v.Resize(100'000);
+        assert(v[0] == 0.0 && v[99'999] == 0.0);
+    }
+    cout << "Done!"s << endl;
+}
+#endif
+
 void TestsLauncher() {
     Test1();
     Test2();
@@ -480,4 +2965,38 @@ void TestsLauncher() {
     TestNoncopiableInsert();
     TestNoncopiableErase();
     TestNoncopiableResize();
+    TestUninitializedStorage();
+    TestEmplace();
+    TestTriviallyRelocatable();
+    TestAllocator();
+    TestSmallSimpleVector();
+    TestGrowthPolicy();
+    TestRangeOperations();
+    TestShrink();
+    TestAlignedStorage();
+    TestStats();
+    TestBatchErase();
+    TestSwapErase();
+    TestParallel();
+    TestCompare();
+    TestCopyOnWrite();
+    TestMappedSimpleVector();
+    TestSerialization();
+    TestSimpleVectorView();
+    TestConcurrentSimpleVector();
+    TestSegmentedSimpleVector();
+    TestSoaVector();
+    TestConstexpr();
+    TestFlatContainers();
+    TestPackedBools();
+    TestRelocationGuarantees();
+    TestBackInserter();
+    TestBufferQueue();
+#if SIMPLE_VECTOR_HAS_COROUTINES
+    TestBufferQueueCoroutines();
+#endif
+    TestPooledAllocator();
+#if defined(__linux__)
+    TestHugePageAllocator();
+#endif
 }
\ No newline at end of file